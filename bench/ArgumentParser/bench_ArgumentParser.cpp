@@ -0,0 +1,508 @@
+// MIT License
+//
+// Copyright (c) 2024 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include <array>
+#include <memory_resource>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <regex>
+#include <thread>
+#include <string>
+#include <vector>
+#include <net_ln3/cpp_lib/ArgumentParser.h>
+#include <net_ln3/cpp_lib/ParseUtil.h>
+#include "../bench.h"
+
+using namespace net_ln3::cpp_lib;
+
+namespace {
+    const std::vector<std::string> tokens = ParseUtil::split(
+        "build --target release -j 16 --define NAME=value src/main.cpp -v --output-dir out/ x --- -");
+
+    /// 正規表現による従来の判定処理(比較用)
+    size_t classifyByRegex(const std::string& arg_) {
+        static const std::regex option_name_pattern{"--.+"};
+        static const std::regex alias_name_pattern{"-.+"};
+        static const std::regex extract_option_name_pattern{"^--"};
+        static const std::regex extract_alias_name_pattern{"^-"};
+        if (std::regex_match(arg_, option_name_pattern)) {
+            return std::regex_replace(arg_, extract_option_name_pattern, "").size();
+        }
+        if (std::regex_match(arg_, alias_name_pattern)) {
+            return std::regex_replace(arg_, extract_alias_name_pattern, "").size();
+        }
+        return 0;
+    }
+
+    /// count_個から選んだ、オプション名とエイリアスを交互に並べた16個の名称
+    std::vector<std::string> makeNames(const size_t count_) {
+        std::vector<std::string> names;
+        for (size_t i = 0; i < 16; i++) {
+            const size_t index = i * 7919 % count_;
+            names.push_back(i % 2 == 0 ? "option-" + std::to_string(index) : "o" + std::to_string(index));
+        }
+        return names;
+    }
+
+    /// 正規表現とstd::stollによる従来の検証・変換処理(比較用)
+    long long convertByRegex(const std::string& value_) {
+        static const std::regex signed_pattern(R"([+\-]?(([1-9][0-9]{0,18})|0))");
+        if (!std::regex_match(value_, signed_pattern)) { return 0; }
+        try { static_cast<void>(std::stoll(value_)); }
+        catch (std::exception&) { return 0; }
+        return std::stoll(value_);
+    }
+
+    size_t classifyByScanner(const std::string& arg_) {
+        if (const auto [kind, name_offset] = ArgumentParser::classifyToken(arg_); kind != ArgumentParser::TokenKind::ARGUMENT) {
+            return arg_.size() - name_offset;
+        }
+        return 0;
+    }
+}
+
+void net_ln3::cpp_lib::bench::benchArgumentParser() {
+    constexpr size_t iterations = 100000;
+    measure("classifyToken/regex (per command line)", iterations, [] {
+        size_t total = 0;
+        for (const auto& t : tokens) { total += classifyByRegex(t); }
+        doNotOptimize(total);
+    });
+    measure("classifyToken/scanner (per command line)", iterations, [] {
+        size_t total = 0;
+        for (const auto& t : tokens) { total += classifyByScanner(t); }
+        doNotOptimize(total);
+    });
+    // 符号付き整数の検証と変換(正規表現+std::stollとstd::from_charsの比較)
+    {
+        const std::vector<std::string> values = {"16", "-500", "9223372036854775807", "0.25", "12ab", "+42"};
+        measure("SIGNED/regex+stoll (6 values)", iterations, [&values] {
+            long long total = 0;
+            for (const auto& v : values) { total += convertByRegex(v); }
+            doNotOptimize(total);
+        });
+        measure("SIGNED/from_chars (6 values)", iterations, [&values] {
+            long long total = 0;
+            for (const auto& v : values) { total += ParseUtil::StringValidator::parseSigned(v).value_or(0); }
+            doNotOptimize(total);
+        });
+    }
+    // 数値の文字列への変換(std::to_stringとstd::to_charsの比較)
+    {
+        const std::vector values = {
+            ArgumentParser::OptionValue::createInstance(-500), ArgumentParser::OptionValue::createInstance(0.25l),
+            ArgumentParser::OptionValue::createInstance(9223372036854775807ll),
+            ArgumentParser::OptionValue::createInstance(6.02214076e23l),
+            ArgumentParser::OptionValue::createInstance(18446744073709551615ull),
+            ArgumentParser::OptionValue::createInstance(0.1l)
+        };
+        std::string buffer;
+        measure("getString/to_string (6 values)", iterations, [&values, &buffer] {
+            buffer.clear();
+            for (const auto& v : values) {
+                buffer += v.isSigned()
+                              ? std::to_string(v.getSigned())
+                              : v.isUnsigned()
+                              ? std::to_string(v.getUnsigned())
+                              : std::to_string(v.getLongDouble());
+                buffer.push_back(' ');
+            }
+            doNotOptimize(buffer);
+        });
+        measure("getString/to_chars (6 values)", iterations, [&values, &buffer] {
+            buffer.clear();
+            for (const auto& v : values) {
+                buffer += v.getString();
+                buffer.push_back(' ');
+            }
+            doNotOptimize(buffer);
+        });
+        measure("appendString/to_chars (6 values)", iterations, [&values, &buffer] {
+            buffer.clear();
+            for (const auto& v : values) {
+                v.appendString(buffer);
+                buffer.push_back(' ');
+            }
+            doNotOptimize(buffer);
+        });
+    }
+    // 多数の型付きオプションのうち1つだけを読む場合の、即時変換と遅延変換の比較
+    {
+        ArgumentParser::OptionNames names;
+        std::vector<std::string_view> args;
+        std::vector<std::string> storage;
+        storage.reserve(200);
+        for (int i = 0; i < 100; i++) {
+            storage.push_back("--ratio" + std::to_string(i));
+            names.addOption(storage.back().substr(2), ArgumentParser::OptionType::LONG_DOUBLE);
+            args.emplace_back(storage.back());
+            storage.push_back(std::to_string(i) + ".125e2");
+            args.emplace_back(storage.back());
+        }
+        const auto eager = std::make_shared<ArgumentParser::Schema>(names);
+        auto lazy = std::make_shared<ArgumentParser::Schema>(names);
+        lazy->enableLazyConversion();
+        for (const auto& [label, schema] : {std::pair{"eager", eager}, std::pair{"lazy", lazy}}) {
+            ArgumentParser::ParseResult result;
+            measure(std::string("LONG_DOUBLE/") + label + " (100 options, 1 read)", iterations,
+                    [&schema, &result, &args] {
+                        result.reset();
+                        schema->parseView(args, result);
+                        doNotOptimize(result.findOption("ratio50")->getLongDouble());
+                    });
+        }
+    }
+    measure("ArgumentParser::parse (per command line)", iterations, [] {
+        ArgumentParser parser;
+        parser.parse(tokens);
+        doNotOptimize(parser);
+    });
+    const std::vector<std::string_view> token_views(tokens.begin(), tokens.end());
+    measure("ArgumentParser::parseView (per command line)", iterations, [&token_views] {
+        ArgumentParser parser;
+        parser.parseView(token_views);
+        doNotOptimize(parser);
+    });
+    {
+        ArgumentParser parser;
+        measure("ArgumentParser::parse/reset (per command line)", iterations, [&parser] {
+            parser.reset();
+            parser.parse(tokens);
+            doNotOptimize(parser);
+        });
+    }
+    // 繰り返し指定されるオプションを、複数の値を持つオプションとして格納する場合
+    {
+        std::vector<std::string> storage;
+        for (int i = 0; i < 2000; i++) { storage.push_back("NAME_" + std::to_string(i) + "=1"); }
+        std::vector<std::string_view> defines;
+        for (const auto& define : storage) { defines.insert(defines.end(), {"--define", define}); }
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+            {{"define", ArgumentParser::OptionType::STRING_LIST}}));
+        ArgumentParser::ParseResult result;
+        measure("Schema::parseView/STRING_LIST (2000 values)", iterations / 100, [&schema, &result, &defines] {
+            result.reset();
+            schema.parseView(defines, result);
+            doNotOptimize(result.getStringList("define"));
+        });
+    }
+    // カンマ区切りの配列(要素ごとの分割・変換と、1回の走査による変換の比較)
+    {
+        std::string ids;
+        for (int i = 0; i < 100000; i++) {
+            if (i != 0) { ids.push_back(','); }
+            ids += std::to_string(1000000007ll * i % 10000000000000ll);
+        }
+        // ParseUtil::splitは要素数に対して2乗の時間がかかるため、std::string::findで分割する。
+        measure("std::string::find + std::stoll (100k ids)", 100, [&ids] {
+            std::vector<long long> values;
+            for (size_t begin = 0, end = 0; end != std::string::npos; begin = end + 1) {
+                end = ids.find(',', begin);
+                values.push_back(std::stoll(ids.substr(begin, end - begin)));
+            }
+            doNotOptimize(values);
+        });
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+            {{"ids", ArgumentParser::OptionType::SIGNED_ARRAY}}));
+        const std::vector<std::string_view> args = {"--ids", ids};
+        ArgumentParser::ParseResult result;
+        measure("Schema::parseView/SIGNED_ARRAY (100k ids)", 100, [&schema, &result, &args] {
+            result.reset();
+            schema.parseView(args, result);
+            doNotOptimize(result.getOption("ids").getSignedArray());
+        });
+    }
+    // 環境変数による値の補完(取得の度のstd::getenvと、パース時に1回だけ走査した結果の比較)
+    {
+        std::vector<std::string> names;
+        std::vector<std::string> variables;
+        for (int i = 0; i < 8; i++) {
+            names.push_back("option-" + std::to_string(i));
+            variables.push_back("NET_LN3_BENCH_OPTION_" + std::to_string(i));
+#ifdef _WIN32
+            _putenv_s(variables.back().c_str(), "42");
+#else
+            setenv(variables.back().c_str(), "42", 1);
+#endif
+        }
+        measure("std::getenv + std::stoll (8 lookups)", iterations, [&variables] {
+            long long total = 0;
+            for (const auto& variable : variables) {
+                if (const char* value = std::getenv(variable.c_str()); value != nullptr) { total += std::stoll(value); }
+            }
+            doNotOptimize(total);
+        });
+        ArgumentParser::OptionNames option_names;
+        for (const auto& name : names) { option_names.addOption(name, ArgumentParser::OptionType::SIGNED); }
+        ArgumentParser::Schema schema(option_names);
+        schema.enableEnvironment("NET_LN3_BENCH_");
+        const ArgumentParser::ParseResult result = schema.parseView(std::vector<std::string_view>{});
+        measure("ParseResult::findOption after enableEnvironment (8 lookups)", iterations, [&result, &names] {
+            long long total = 0;
+            for (const auto& name : names) {
+                if (const auto value = result.findOption(name); value != nullptr) { total += value->getSigned(); }
+            }
+            doNotOptimize(total);
+        });
+        ArgumentParser::ParseResult reused;
+        measure("Schema::parseView with enableEnvironment (snapshot per parse)", iterations, [&schema, &reused] {
+            reused.reset();
+            schema.parseView(std::vector<std::string_view>{}, reused);
+            doNotOptimize(reused);
+        });
+    }
+    // key=value形式の設定ファイル(std::getline + ParseUtil::splitと、マップした内容の走査の比較)
+    {
+        const auto path = std::filesystem::temp_directory_path() / "cpp-libs-bench-config_file.conf";
+        ArgumentParser::OptionNames option_names;
+        {
+            std::ofstream file(path, std::ios::binary);
+            for (int i = 0; i < 300; i++) {
+                const auto name = "setting-" + std::to_string(i);
+                option_names.addOption(name, i % 2 == 0
+                                                 ? ArgumentParser::OptionType::SIGNED
+                                                 : ArgumentParser::OptionType::STRING);
+                file << name << "=" << (i % 2 == 0 ? std::to_string(i * 7) : "value_" + std::to_string(i)) << "\n";
+            }
+        }
+        ArgumentParser parser(option_names);
+        measure("std::getline + ParseUtil::split (300 settings)", iterations / 100, [&path, &parser] {
+            parser.reset();
+            std::vector<std::string> args;
+            std::ifstream file(path);
+            for (std::string line; std::getline(file, line);) {
+                const auto pair = ParseUtil::split(line, "=");
+                args.insert(args.end(), {"--" + pair[0], pair[1]});
+            }
+            parser.parse(args);
+            doNotOptimize(parser);
+        });
+        ArgumentParser::Schema schema(option_names);
+        schema.enableConfigFile(path);
+        ArgumentParser::ParseResult result;
+        measure("Schema::enableConfigFile (300 settings)", iterations / 100, [&schema, &result] {
+            result.reset();
+            schema.parseView(std::vector<std::string_view>{}, result);
+            doNotOptimize(result);
+        });
+        std::filesystem::remove(path);
+    }
+    // `--name=value`と`-abc`(引数を書き換えてからのパースと、引数の上での分割の比較)
+    {
+        ArgumentParser::OptionNames option_names({
+            {"verbose", ArgumentParser::OptionType::BOOLEAN}, {"force", ArgumentParser::OptionType::BOOLEAN},
+            {"jobs", ArgumentParser::OptionType::UNSIGNED}
+        });
+        for (int i = 0; i < 8; i++) {
+            option_names.addOption("name" + std::to_string(i), ArgumentParser::OptionType::STRING);
+        }
+        ArgumentParser::Schema schema(option_names, ArgumentParser::OptionAlias({
+                                          {"v", "verbose"}, {"f", "force"}, {"j", "jobs"}
+                                      }));
+        std::vector<std::string_view> args = {"-vfj", "8"};
+        std::vector<std::string> storage;
+        for (int i = 0; i < 8; i++) { storage.push_back("--name" + std::to_string(i) + "=value" + std::to_string(i)); }
+        args.insert(args.end(), storage.begin(), storage.end());
+        ArgumentParser::ParseResult result;
+        measure("rewrite argv + Schema::parse (10 tokens)", iterations, [&schema, &args, &result] {
+            result.reset();
+            std::vector<std::string> rewritten;
+            for (const auto arg : args) {
+                const size_t separator = arg.find('=');
+                if (arg.starts_with("--") && separator != std::string_view::npos) {
+                    rewritten.emplace_back(arg.substr(0, separator));
+                    rewritten.emplace_back(arg.substr(separator + 1));
+                }
+                else if (arg.size() > 2 && arg[0] == '-' && arg[1] != '-') {
+                    for (const char c : arg.substr(1)) { rewritten.push_back({'-', c}); }
+                }
+                else { rewritten.emplace_back(arg); }
+            }
+            schema.parse(rewritten, result);
+            doNotOptimize(result);
+        });
+        measure("Schema::parseView with --name=value and -abc (10 tokens)", iterations, [&schema, &args, &result] {
+            result.reset();
+            schema.parseView(args, result);
+            doNotOptimize(result);
+        });
+    }
+    // サブコマンドの選択(名称を順に比較する分岐と、CommandTreeのトライ木の比較)
+    {
+        const auto global = std::make_shared<const ArgumentParser::Schema>(
+            ArgumentParser::OptionNames({{"verbose", ArgumentParser::OptionType::BOOLEAN}}));
+        std::vector<ArgumentParser::CommandTree::Command> commands;
+        for (int i = 0; i < 300; i++) {
+            commands.push_back({"command-" + std::to_string(i), std::make_shared<const ArgumentParser::Schema>(
+                                    ArgumentParser::OptionNames({{"jobs", ArgumentParser::OptionType::UNSIGNED}}))});
+        }
+        const std::vector<std::string_view> args = {"--verbose", "command-299", "--jobs", "8", "target"};
+        ArgumentParser::ParseResult result;
+        measure("linear command dispatch (300 commands)", iterations, [&commands, &args, &result] {
+            result.reset();
+            const auto found = std::ranges::find_if(commands, [&args](const auto& command_) {
+                return command_.path == args[1];
+            });
+            found->schema->parseView(std::span(args).subspan(2), result);
+            doNotOptimize(result);
+        });
+        const ArgumentParser::CommandTree tree(global, commands);
+        measure("CommandTree::parseView (300 commands)", iterations, [&tree, &args, &result] {
+            result.reset();
+            tree.parseView(args, result);
+            doNotOptimize(result);
+        });
+    }
+    // ほとんどの引数が誤りである場合の記録
+    {
+        std::vector<std::string_view> noisy;
+        for (int i = 0; i < 16; i++) {
+            noisy.insert(noisy.end(), {"--unknown-option", "value", "-x", "value", "--count", "not-a-number"});
+        }
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames({{"count", ArgumentParser::OptionType::SIGNED}}));
+        ArgumentParser::ParseResult result;
+        measure("Schema::parseView/mostly invalid (48 errors)", iterations, [&schema, &result, &noisy] {
+            result.reset();
+            schema.parseView(noisy, result);
+            doNotOptimize(result);
+        });
+    }
+    measure("ArgumentParser::parse/monotonic arena (per command line)", iterations, [] {
+        std::array<std::byte, 4096> buffer{};
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size());
+        ArgumentParser parser(&arena);
+        parser.parse(tokens);
+        doNotOptimize(parser);
+    });
+    // コマンドライン文字列の分割(ParseUtil::splitとShellTokenizerの比較)
+    {
+        std::string command;
+        for (size_t i = 0; i < 64; i++) {
+            command += "--define NAME_" + std::to_string(i) + "=value src/module_" + std::to_string(i) + "/main.cpp ";
+        }
+        measure("ParseUtil::split (1 KiB+ command line)", 10000, [&command] {
+            doNotOptimize(ParseUtil::split(command));
+        });
+        measure("ParseUtil::ShellTokenizer (1 KiB+ command line)", 10000, [&command] {
+            size_t total = 0;
+            ParseUtil::ShellTokenizer tokenizer(command);
+            while (tokenizer.next()) { total += tokenizer.getToken().size(); }
+            doNotOptimize(total);
+        });
+        measure("ArgumentParser::parseCommandLineView (1 KiB+)", 10000, [&command] {
+            ArgumentParser parser;
+            parser.parseCommandLineView(command);
+            doNotOptimize(parser);
+        });
+    }
+    // 並列パースのスケーリング(1スレッドから、論理コア数まで)
+    {
+        std::vector<std::vector<std::string>> batch(200000, tokens);
+        ArgumentParser::Schema schema;
+        const size_t max_threads = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+        std::vector<size_t> thread_counts;
+        for (size_t threads = 1; threads < max_threads; threads *= 2) { thread_counts.push_back(threads); }
+        thread_counts.push_back(max_threads);
+        double single = 0;
+        for (const size_t threads : thread_counts) {
+            const auto begin = std::chrono::steady_clock::now();
+            doNotOptimize(schema.parseBatch(batch, threads));
+            const auto end = std::chrono::steady_clock::now();
+            const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(
+                batch.size());
+            if (threads == 1) { single = ns; }
+            std::printf("%-56s %14.1f ns/op (x%.2f)\n",
+                        ("Schema::parseBatch/" + std::to_string(threads) + " threads (per command line)").c_str(), ns,
+                        single / ns);
+        }
+    }
+    // オプション名の検索(OptionNames, OptionAliasとFrozenOptionTableの比較)
+    for (const size_t count : {10, 100, 10000}) {
+        ArgumentParser::OptionNames names;
+        ArgumentParser::OptionAlias alias;
+        for (size_t i = 0; i < count; i++) {
+            names.addOption("option-" + std::to_string(i), ArgumentParser::OptionType::STRING);
+            alias.addAlias("o" + std::to_string(i), "option-" + std::to_string(i));
+        }
+        const ArgumentParser::FrozenOptionTable frozen(names, alias);
+        const auto lookup_names = makeNames(count);
+        measure("lookup/unordered_map/" + std::to_string(count) + " options (16 names)", iterations,
+                [&names, &alias, &lookup_names] {
+                    size_t total = 0;
+                    for (size_t i = 0; i < lookup_names.size(); i++) {
+                        const std::string option_name = i % 2 == 0
+                                                            ? lookup_names[i]
+                                                            : alias.getOptionName(lookup_names[i]);
+                        if (names.isExistOption(option_name)) {
+                            total += static_cast<size_t>(names.getOptionType(option_name));
+                        }
+                    }
+                    doNotOptimize(total);
+                });
+        measure("lookup/freeze/" + std::to_string(count) + " options (16 names)", iterations,
+                [&frozen, &lookup_names] {
+                    size_t total = 0;
+                    for (size_t i = 0; i < lookup_names.size(); i++) {
+                        const auto entry = i % 2 == 0
+                                               ? frozen.findOption(lookup_names[i])
+                                               : frozen.findAlias(lookup_names[i]);
+                        if (entry.has_value()) { total += static_cast<size_t>(entry->type); }
+                    }
+                    doNotOptimize(total);
+                });
+    }
+    // 接頭辞による補完(すべての名称の走査と、freeze()で作成した索引の比較)
+    {
+        ArgumentParser::OptionNames names;
+        std::vector<std::string> all_names;
+        for (size_t i = 0; i < 10000; i++) {
+            all_names.push_back("option-" + std::to_string(i));
+            names.addOption(all_names.back(), ArgumentParser::OptionType::STRING);
+        }
+        const ArgumentParser::FrozenOptionTable frozen(names, {});
+        std::vector<std::string_view> completions;
+        measure("complete/linear scan/10000 options (\"option-99\")", iterations / 10, [&all_names, &completions] {
+            completions.clear();
+            for (const auto& name : all_names) {
+                if (name.starts_with("option-99")) { completions.push_back(name); }
+            }
+            std::ranges::sort(completions);
+            doNotOptimize(completions);
+        });
+        measure("complete/freeze/10000 options (\"option-99\")", iterations, [&frozen, &completions] {
+            completions.clear();
+            frozen.completeOption("option-99", completions);
+            doNotOptimize(completions);
+        });
+        measure("complete/freeze/10000 options (\"option-\", all)", iterations / 100, [&frozen, &completions] {
+            completions.clear();
+            frozen.completeOption("option-", completions);
+            doNotOptimize(completions);
+        });
+    }
+}
@@ -0,0 +1,72 @@
+// MIT License
+//
+// Copyright (c) 2024 Saku Shirakura <saku@sakushira.com>
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+/**
+ * @file bench.h
+ * @brief ベンチマーク用の簡易な計測関数を定義しています。
+ * @details 外部のベンチマークライブラリに依存しないよう、std::chronoのみで計測します。
+ * @author saku shirakura (saku@sakushira.com)
+ * @since v0.2.0-alpha
+ */
+
+#ifndef CPP_LIBS_BENCH_H
+#define CPP_LIBS_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace net_ln3::cpp_lib::bench {
+    /**
+     * @brief 最適化によって計測対象の処理が取り除かれないようにします。
+     * @param value_ 計測結果として保持する値
+     */
+    template <class T>
+    void doNotOptimize(const T& value_) {
+        static volatile const void* sink;
+        sink = &value_;
+        static_cast<void>(sink);
+    }
+
+    /**
+     * @brief func_をiterations_回実行し、1回あたりの平均時間を出力します。
+     * @param name_ 出力する計測名
+     * @param iterations_ 実行回数
+     * @param func_ 計測対象の処理
+     * @return 1回あたりの平均時間(ns)
+     */
+    template <class F>
+    double measure(const std::string& name_, const size_t iterations_, F&& func_) {
+        const auto begin = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations_; i++) { func_(); }
+        const auto end = std::chrono::steady_clock::now();
+        const double ns = std::chrono::duration<double, std::nano>(end - begin).count() / static_cast<double>(
+            iterations_);
+        std::printf("%-56s %14.1f ns/op\n", name_.c_str(), ns);
+        return ns;
+    }
+
+    void benchArgumentParser();
+}
+
+#endif //CPP_LIBS_BENCH_H
@@ -32,12 +32,25 @@
 #ifndef DEVELOPER_TOOL_COMMANDPARSER_H
 #define DEVELOPER_TOOL_COMMANDPARSER_H
 
-#include <regex>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
+#include <net_ln3/cpp_lib/multi_platform_util.h>
 
 namespace net_ln3::cpp_lib {
     /**
@@ -62,9 +75,38 @@ namespace net_ln3::cpp_lib {
      * */
     class ArgumentParser {
     public:
+        class CommandTree;
+        class FrozenOptionTable;
+        class ParseResult;
+        class Schema;
+
+        /**
+         * @brief `std::string`, `std::string_view`, `const char*`のいずれでも検索できるハッシュ関数です。
+         * @details `std::equal_to<>`と組み合わせて`std::unordered_map`に使用すると、一時的な`std::string`を作成せずに検索できます。
+         * @since v0.2.0-alpha
+         */
+        struct TransparentStringHash {
+            using is_transparent = void;
+
+            size_t operator()(const std::string_view str_) const noexcept { return std::hash<std::string_view>{}(str_); }
+        };
+
+        /**
+         * @brief `std::string_view`で検索できる、文字列をキーとしたマップです。
+         * @since v0.2.0-alpha
+         */
+        template <class T>
+        using StringMap = std::unordered_map<std::string, T, TransparentStringHash, std::equal_to<>>;
+
         /**
          * @brief OptionValueが受け入れ可能な型を表す列挙型です。
+         * @details `*_LIST`の型のオプションは、複数回指定でき、すべての値が指定された順に1つの配列に格納されます。
+         * 値はOptionValueではなく、ParseResult::getSignedList()などで取得します。
+         * @details `*_ARRAY`の型のオプションは、1つの引数にカンマ区切りで複数の値を指定します。(例: `--ids 1,2,3`)
+         * 値は1回の走査で連続した領域に変換され、OptionValue::getSignedArray()などで取得します。
          * @since v0.1.0-alpha
+         * @version v0.2.0-alpha 複数の値を持つ型(`*_LIST`)を追加しました。
+         * @version v0.2.0-alpha カンマ区切りの配列の型(`*_ARRAY`)を追加しました。
          */
         enum class OptionType {
             STRING,
@@ -73,7 +115,58 @@ namespace net_ln3::cpp_lib {
             LONG_DOUBLE,
             BOOLEAN,
             NULLITY,
-            ERROR
+            ERROR,
+            /// 文字列の配列
+            STRING_LIST,
+            /// 符号付き整数の配列
+            SIGNED_LIST,
+            /// 符号なし整数の配列
+            UNSIGNED_LIST,
+            /// 浮動小数点数の配列
+            LONG_DOUBLE_LIST,
+            /// カンマ区切りの符号付き整数の配列
+            SIGNED_ARRAY,
+            /// カンマ区切りの符号なし整数の配列
+            UNSIGNED_ARRAY,
+            /// カンマ区切りの浮動小数点数の配列
+            LONG_DOUBLE_ARRAY
+        };
+
+        /**
+         * @brief コマンドライン引数の種類を表す列挙型です。
+         * @since v0.2.0-alpha
+         */
+        enum class TokenKind {
+            ARGUMENT,
+            OPTION,
+            ALIAS
+        };
+
+        /**
+         * @brief classifyTokenの判定結果です。
+         * @details name_offsetは接頭辞(`--`または`-`)を取り除いた名称の開始位置です。ARGUMENTの場合は0です。
+         * @since v0.2.0-alpha
+         */
+        struct TokenClass {
+            TokenKind kind;
+            size_t name_offset;
+        };
+
+        /**
+         * @brief 例外を送出しない関数(tryParse(), tryGetOption()など)が、失敗の理由を返すためのエラーコードです。
+         * @since v0.2.0-alpha
+         */
+        enum class ErrorCode {
+            /// 成功しました。
+            NONE,
+            /// オプションが存在しません。
+            NOT_FOUND,
+            /// 格納されている値の型が、要求された型と異なります。
+            TYPE_MISMATCH,
+            /// 無効なオプション・型が無効なオプション・無効なエイリアスのいずれかが記録されています。
+            INVALID_ARGUMENTS,
+            /// メモリを確保できませんでした。
+            OUT_OF_MEMORY
         };
 
         /**
@@ -81,13 +174,28 @@ namespace net_ln3::cpp_lib {
          * @details
          * ## 利用可能な型
          * - 文字列(`std::string`)
+         * - 文字列の参照(`std::string_view`) 参照先の文字列はOptionValueより長く存在する必要があります。
          * - 符号付き整数(`int64_t`)
          * - 符号なし整数(`uint64_t`)
          * - 倍精度浮動小数点数(`double`)
          * - 真偽型(`bool`)
          * 格納時に型の互換性確認が行われます。たとえば、`float`は`double`と互換性があります。
          *
+         * ## メモリ使用量
+         * 値は1バイトの型タグと8バイトの値(整数、真偽値、文字列へのポインタ)からなる16バイトの表現で格納されます。
+         * 値の種類ごとに、16バイトの他に必要な領域は次のとおりです。
+         * - 整数、真偽値、`std::string_view`は追加の領域を使用しません。
+         * - `long double`は、x86-64(80ビット拡張精度)や`double`と同じ表現の環境では追加の領域を使用しません。
+         *   それ以外の環境では、参照カウントと値からなる領域(32バイト)を1回確保します。
+         * - パースした文字列は、パース結果の文字列領域(またはマップしたファイル)に格納し、値ごとの確保は行いません。
+         *   パース結果からコピーしたOptionValueは、参照カウント(8バイト)と文字列からなる領域を1回確保して所有します。
+         * - `std::string`から作成した値は、参照カウント(8バイト)と文字列からなる領域を1回確保して所有します。
+         *   従来の`std::string`はSSOにより15文字以下で確保を行いませんでしたが、この表現では長さによらず確保します。
+         * - 配列は、参照カウントと要素からなる領域を1回確保します。
+         * 所有する値のコピーは参照カウントを増やすのみで、メモリを確保しません。
+         *
          * @since v0.1.0-alpha
+         * @version v0.2.0-alpha 16バイトの表現で格納するようにしました。
          */
         class OptionValue {
         public:
@@ -98,6 +206,27 @@ namespace net_ln3::cpp_lib {
              */
             OptionValue();
 
+            /**
+             * @brief 値をコピーします。
+             * @details 変換が遅延されている値(Schema::enableLazyConversion()を参照)は、コピー先で変換した値を格納します。
+             * そのため、コピーした値はパース結果や引数の文字列を参照しません。コピー元は変更されません。
+             * @throw std::bad_alloc 変換した値を格納する領域を確保できない場合
+             * @since v0.2.0-alpha
+             */
+            OptionValue(const OptionValue& other_);
+
+            OptionValue(OptionValue&& other_) noexcept = default;
+
+            /**
+             * @brief 値をコピーします。詳細はOptionValue(const OptionValue&)を参照してください。
+             * @since v0.2.0-alpha
+             */
+            OptionValue& operator=(const OptionValue& other_);
+
+            OptionValue& operator=(OptionValue&& other_) noexcept = default;
+
+            ~OptionValue() = default;
+
             /**
              * @brief 使用可能な型を含むOptionValueのインスタンスを生成します。
              * @details 型確認をした後に、それが使用可能な型であればインスタンスを生成し、そうでなければ例外を送出します。
@@ -120,13 +249,36 @@ namespace net_ln3::cpp_lib {
              * @brief クラスが格納している値を文字列として取得する。
              * @details 格納している値がNullの場合は、default_を返します。
              * @details 真偽型は、value ? "true" : "false"のように、状態に応じた値を返します。
-             * @details 符号付き整数、符号なし整数、浮動小数点数はstd::to_string()によって文字列に変換され、その値が返されます。
+             * @details 符号付き整数、符号なし整数、浮動小数点数はstd::to_chars()によって文字列に変換され、その値が返されます。
+             * 浮動小数点数は、StringValidator::parseLongDouble()で元の値に戻せる最短の表現になります。
              * @param default_ 文字列に変換できない場合に使用される値 初期値は空文字列("")
              * @return 格納している文字列
              * @since v0.1.0-alpha
+             * @version v0.2.0-alpha std::to_string()の代わりにstd::to_chars()を使用し、浮動小数点数を最短の表現で返すようにしました。
              */
             [[nodiscard]] std::string getString(const std::string& default_ = "") const;
 
+            /**
+             * @brief クラスが格納している値を文字列として、buffer_の末尾に追加します。
+             * @details 変換の規則はgetString()と同一です。数値の変換にはスタック上の領域を使用するため、
+             * buffer_に十分な容量がある場合はメモリを確保しません。
+             * @details 複数の値を1つの文字列に連結する場合に、値ごとに`std::string`を作成せずに済みます。
+             * @param buffer_ 文字列の追加先
+             * @param default_ 文字列に変換できない場合に使用される値 初期値は空文字列("")
+             * @since v0.2.0-alpha
+             */
+            void appendString(std::string& buffer_, std::string_view default_ = "") const;
+
+            /**
+             * @brief クラスが格納している文字列を、コピーせずに参照として取得する。
+             * @details 格納している値が文字列でない場合は、default_を返します。
+             * @details 戻り値はこのインスタンス(`std::string`を格納している場合)、または参照先の文字列(`std::string_view`を格納している場合)が破棄されると無効になります。
+             * @param default_ 値が文字列でない場合に使用される値 初期値は空文字列("")
+             * @return 格納している文字列の参照
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::string_view getStringView(std::string_view default_ = "") const noexcept;
+
             /**
              * @brief クラスが格納している値を符号付き整数として取得する。
              * @details 格納している値が符号付き整数であればその値を返し、それ以外の場合はdefault_の値を返します。
@@ -134,7 +286,7 @@ namespace net_ln3::cpp_lib {
              * @return 格納している符号付き整数
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] long long getSigned(long long default_ = 0) const;
+            [[nodiscard]] long long getSigned(long long default_ = 0) const noexcept;
 
             /**
              * @brief クラスが格納している値を符号なし整数として取得する。
@@ -143,7 +295,7 @@ namespace net_ln3::cpp_lib {
              * @return 格納している符号なし整数
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] unsigned long long getUnsigned(unsigned long long default_ = 0) const;
+            [[nodiscard]] unsigned long long getUnsigned(unsigned long long default_ = 0) const noexcept;
 
             /**
              * @brief クラスが格納している値を浮動小数点数として取得する。
@@ -152,7 +304,7 @@ namespace net_ln3::cpp_lib {
              * @return 格納している浮動小数点数
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] long double getLongDouble(long double default_ = 0.0l) const;
+            [[nodiscard]] long double getLongDouble(long double default_ = 0.0l) const noexcept;
 
             /**
              * @brief クラスが格納している値を真偽型として取得する。
@@ -161,49 +313,126 @@ namespace net_ln3::cpp_lib {
              * @return 格納している真偽値
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool getBoolean(bool default_ = false) const;
+            [[nodiscard]] bool getBoolean(bool default_ = false) const noexcept;
+
+            /**
+             * @brief クラスが格納している符号付き整数の配列(OptionType::SIGNED_ARRAY)を取得します。
+             * @details 戻り値はこのインスタンスと、そのコピーがすべて破棄されると無効になります。
+             * @return 格納している配列。値が符号付き整数の配列でない場合は空の配列
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::span<const long long> getSignedArray() const noexcept;
+
+            /**
+             * @brief クラスが格納している符号なし整数の配列(OptionType::UNSIGNED_ARRAY)を取得します。
+             * @details 戻り値の有効期間はgetSignedArray()と同一です。
+             * @return 格納している配列。値が符号なし整数の配列でない場合は空の配列
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::span<const unsigned long long> getUnsignedArray() const noexcept;
+
+            /**
+             * @brief クラスが格納している浮動小数点数の配列(OptionType::LONG_DOUBLE_ARRAY)を取得します。
+             * @details 戻り値の有効期間はgetSignedArray()と同一です。
+             * @return 格納している配列。値が浮動小数点数の配列でない場合は空の配列
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::span<const long double> getLongDoubleArray() const noexcept;
 
             /**
              * @brief クラスが格納している値がNullであるかを確認する。
              * @return 格納している値がNullであるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isNull() const;
+            [[nodiscard]] bool isNull() const noexcept;
 
             /**
              * @brief クラスが格納している値が文字列であるかを確認する。
+             * @details `std::string_view`を格納している場合も文字列として扱います。
              * @return 格納している値が文字列であるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isString() const;
+            [[nodiscard]] bool isString() const noexcept;
 
             /**
              * @brief クラスが格納している値が符号付き整数であるかを確認する。
              * @return 格納している値の符号付き整数であるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isSigned() const;
+            [[nodiscard]] bool isSigned() const noexcept;
 
             /**
              * @brief クラスが格納している値が符号なし整数であるかを確認する。
              * @return 格納している値が符号なし整数であるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isUnsigned() const;
+            [[nodiscard]] bool isUnsigned() const noexcept;
 
             /**
              * @brief クラスが格納している値が浮動小数点数であるかを確認する。
              * @return 格納している値が浮動小数点数であるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isLongDouble() const;
+            [[nodiscard]] bool isLongDouble() const noexcept;
 
             /**
              * @brief クラスが格納している値の型が真偽型であるかを確認する。
              * @return 格納している値の型が真偽型であるかどうか
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] bool isBoolean() const;
+            [[nodiscard]] bool isBoolean() const noexcept;
+
+            /**
+             * @brief クラスが格納している値が符号付き整数の配列であるかを確認する。
+             * @return 格納している値が符号付き整数の配列であるかどうか
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] bool isSignedArray() const noexcept;
+
+            /**
+             * @brief クラスが格納している値が符号なし整数の配列であるかを確認する。
+             * @return 格納している値が符号なし整数の配列であるかどうか
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] bool isUnsignedArray() const noexcept;
+
+            /**
+             * @brief クラスが格納している値が浮動小数点数の配列であるかを確認する。
+             * @return 格納している値が浮動小数点数の配列であるかどうか
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] bool isLongDoubleArray() const noexcept;
+
+            /**
+             * @brief クラスが格納している値を、例外を送出せずに取得します。
+             * @details 格納している値の型がvalue_の型と一致する場合のみ、value_に値を格納します。
+             * @details value_の型は`long long`, `unsigned long long`, `long double`, `bool`, `std::string_view`のいずれかです。
+             * `std::string_view`の場合、戻り値はgetStringView()と同様にこのインスタンスまたは参照先の文字列を参照します。
+             * @param value_ 値の格納先
+             * @return 成功した場合はErrorCode::NONE、型が異なる場合(Nullを含む)はErrorCode::TYPE_MISMATCH
+             * @since v0.2.0-alpha
+             */
+            ErrorCode tryGet(long long& value_) const noexcept;
+
+            /**
+             * @overload
+             */
+            ErrorCode tryGet(unsigned long long& value_) const noexcept;
+
+            /**
+             * @overload
+             */
+            ErrorCode tryGet(long double& value_) const noexcept;
+
+            /**
+             * @overload
+             */
+            ErrorCode tryGet(bool& value_) const noexcept;
+
+            /**
+             * @overload
+             */
+            ErrorCode tryGet(std::string_view& value_) const noexcept;
 
             /**
              * @brief OptionValue::getString()を省略するための演算子です。
@@ -243,57 +472,231 @@ namespace net_ln3::cpp_lib {
         private:
             /**
              * @brief OptionValueを格納するためのコンテナクラス
+             * @details 型タグと文字列の長さを1つの64ビット整数に、値を8バイトの共用体に格納します。
              * @since v0.1.0-alpha
+             * @version v0.2.0-alpha 16バイトの表現に変更しました。
              */
             class VContainer {
             public:
+                /**
+                 * @brief 保有する値の型
+                 */
+                enum class Type : uint8_t {
+                    NULLITY,
+                    BOOLEAN,
+                    SIGNED,
+                    UNSIGNED,
+                    /// `long double`。表現が16バイトに収まらない環境では、参照カウント付きの領域に格納します。
+                    LONG_DOUBLE,
+                    /// 呼び出し元が所有する文字列の参照
+                    STRING_VIEW,
+                    /// 参照カウント付きの領域に格納した文字列
+                    STRING,
+                    /// パース結果が保持する文字列の参照。コピーする際にSTRINGへ変換されます。
+                    RESULT_STRING,
+                    /// 変換前の文字列の参照。取得する際に変換され、コピーする際にSIGNEDへ変換されます。
+                    LAZY_SIGNED,
+                    /// 変換前の文字列の参照。取得する際に変換され、コピーする際にUNSIGNEDへ変換されます。
+                    LAZY_UNSIGNED,
+                    /// 変換前の文字列の参照。取得する際に変換され、コピーする際にLONG_DOUBLEへ変換されます。
+                    LAZY_LONG_DOUBLE,
+                    /// 参照カウント付きの領域に格納した`long long`の配列
+                    SIGNED_ARRAY,
+                    /// 参照カウント付きの領域に格納した`unsigned long long`の配列
+                    UNSIGNED_ARRAY,
+                    /// 参照カウント付きの領域に格納した`long double`の配列
+                    LONG_DOUBLE_ARRAY
+                };
+
                 VContainer() = delete;
 
-                explicit VContainer(std::nullptr_t v_);
+                explicit VContainer(std::nullptr_t v_) noexcept;
 
                 explicit VContainer(const char* v_);
 
-                explicit VContainer(std::string v_);
+                explicit VContainer(const std::string& v_);
+
+                explicit VContainer(std::string_view v_) noexcept;
 
                 explicit VContainer(long double v_);
 
                 explicit VContainer(double v_);
 
-                explicit VContainer(bool v_);
+                explicit VContainer(bool v_) noexcept;
+
+                explicit VContainer(int v_) noexcept;
+
+                explicit VContainer(unsigned v_) noexcept;
+
+                explicit VContainer(long long v_) noexcept;
+
+                explicit VContainer(unsigned long long v_) noexcept;
+
+                VContainer(const VContainer& other_) noexcept;
 
-                explicit VContainer(int v_);
+                VContainer(VContainer&& other_) noexcept;
 
-                explicit VContainer(unsigned v_);
+                VContainer& operator=(const VContainer& other_) noexcept;
 
-                explicit VContainer(long long v_);
+                VContainer& operator=(VContainer&& other_) noexcept;
 
-                explicit VContainer(unsigned long long v_);
+                ~VContainer();
 
                 /**
-                 * @brief 保有する値の型を確認します。
-                 * @tparam T 保有するか確認したい型
-                 * @return Tと保有する値の型が等しいかどうかの真偽値
+                 * @brief 文字列を参照カウント付きの領域にコピーして保有します。
+                 * @param v_ 保有する文字列
+                 * @return 文字列を保有するコンテナ
                  */
-                template <class T>
-                [[nodiscard]] bool checkType() const { return std::holds_alternative<T>(_value); }
+                static VContainer createOwned(std::string_view v_);
 
                 /**
-                 * @brief 保有する値を取得します。
-                 * @tparam T 取得したい型
-                 * @return 型がTの保有している値
-                 * @exception std::invalid_argument 取得したい型と保有している値の型に互換性がありません。
+                 * @brief パース結果が保持する文字列を、コピーせずに参照として保有します。
+                 * @param v_ パース結果の文字列領域またはマップしたファイル上の文字列
+                 * @return 文字列を参照するコンテナ
                  */
-                template <class T>
-                [[nodiscard]] const T& getTypeValue() const {
-                    if (checkType<T>())
-                        return std::get<T>(_value);
-                    throw std::invalid_argument("[" + std::string(__func__) + "] template type is incompatible.");
-                }
+                static VContainer createResultString(std::string_view v_) noexcept;
+
+                /**
+                 * @brief 検証済みの文字列を、変換せずに参照として保有します。
+                 * @param type_ 変換先の型。SIGNED, UNSIGNED, LONG_DOUBLEのいずれかです。
+                 * @param raw_ 変換先の型として有効な文字列。変換されるまで破棄してはいけません。
+                 * @return 変換前の文字列を保有するコンテナ
+                 */
+                static VContainer createLazy(Type type_, std::string_view raw_) noexcept;
+
+                /**
+                 * @brief 要素を値初期化した配列を、参照カウント付きの領域に確保します。
+                 * @param type_ 配列の型。SIGNED_ARRAY, UNSIGNED_ARRAY, LONG_DOUBLE_ARRAYのいずれかです。
+                 * @param count_ 要素数
+                 * @return 配列を保有するコンテナ
+                 */
+                static VContainer createArray(Type type_, size_t count_);
+
+                /**
+                 * @brief 変換後の型を取得します。変換が遅延されている場合も、変換先の型を返します。
+                 */
+                [[nodiscard]] Type getValueType() const noexcept;
+
+                /**
+                 * @brief 変換が遅延されている場合は変換した値を、それ以外の場合は同じ値を保有するコンテナを作成します。
+                 * @details このインスタンスは変更しないため、複数のスレッドから同時に呼び出せます。
+                 * @return 変換前の文字列を参照しないコンテナ
+                 */
+                [[nodiscard]] VContainer detach() const;
+
+                /**
+                 * @brief 保有する値の型を取得します。
+                 */
+                [[nodiscard]] Type getType() const noexcept { return static_cast<Type>(_meta & _TYPE_MASK); }
+
+                /**
+                 * @brief 保有する値を取得します。型がBOOLEANでない場合の戻り値は未規定です。
+                 */
+                [[nodiscard]] bool getBoolean() const noexcept { return _payload.boolean; }
+
+                /**
+                 * @brief 保有する値を取得します。型がSIGNEDまたはLAZY_SIGNEDでない場合の戻り値は未規定です。
+                 * @details LAZY_SIGNEDの場合は、呼び出しごとに変換します。
+                 */
+                [[nodiscard]] long long getSigned() const noexcept;
+
+                /**
+                 * @brief 保有する値を取得します。型がUNSIGNEDまたはLAZY_UNSIGNEDでない場合の戻り値は未規定です。
+                 * @details LAZY_UNSIGNEDの場合は、呼び出しごとに変換します。
+                 */
+                [[nodiscard]] unsigned long long getUnsigned() const noexcept;
+
+                /**
+                 * @brief 保有する値を取得します。型がLONG_DOUBLEまたはLAZY_LONG_DOUBLEである必要があります。
+                 * @details LAZY_LONG_DOUBLEの場合は、呼び出しごとに変換します。
+                 */
+                [[nodiscard]] long double getLongDouble() const noexcept;
+
+                /**
+                 * @brief 保有する文字列を取得します。型がSTRING, STRING_VIEW, RESULT_STRINGのいずれかである必要があります。
+                 */
+                [[nodiscard]] std::string_view getStringView() const noexcept;
+
+                /**
+                 * @brief 保有する配列を取得します。型がSIGNED_ARRAYである必要があります。
+                 * @details 要素の変更は、同じ領域を共有しているすべてのコピーに反映されます。
+                 */
+                [[nodiscard]] std::span<long long> getSignedArray() const noexcept;
+
+                /**
+                 * @brief 保有する配列を取得します。型がUNSIGNED_ARRAYである必要があります。
+                 */
+                [[nodiscard]] std::span<unsigned long long> getUnsignedArray() const noexcept;
+
+                /**
+                 * @brief 保有する配列を取得します。型がLONG_DOUBLE_ARRAYである必要があります。
+                 */
+                [[nodiscard]] std::span<long double> getLongDoubleArray() const noexcept;
 
             private:
-                std::variant<std::nullptr_t, std::string, long double, bool, long long, unsigned long long> _value;
+                /// 参照カウント付きの領域の先頭。STRINGの場合は直後に文字列、LONG_DOUBLE, `*_ARRAY`の場合は値が続きます。
+                struct _SharedBlock;
+
+                /// _metaのうち、型タグを格納するビット
+                static constexpr uint64_t _TYPE_MASK = 0xff;
+                /// _metaのうち、文字列の長さ(`*_ARRAY`の場合は要素数)を格納する位置
+                static constexpr unsigned _SIZE_SHIFT = 8;
+
+                VContainer(Type type_, uint64_t size_) noexcept
+                    : _meta(static_cast<uint64_t>(type_) | size_ << _SIZE_SHIFT) {
+                }
+
+                /**
+                 * @brief long doubleをLONG_DOUBLEとして保有します。
+                 * @details 表現が16バイトに収まる環境では直接格納し、それ以外の環境では参照カウント付きの領域に格納します。
+                 * 現在保有している値は解放しません。
+                 * @return 領域を確保できた場合はtrue。確保できない場合は何も変更しません。
+                 */
+                bool _storeLongDouble(long double v_) noexcept;
+
+                /**
+                 * @brief LAZY_*の変換前の文字列を取得します。
+                 */
+                [[nodiscard]] std::string_view _lazyView() const noexcept;
+
+                /**
+                 * @brief 参照カウント付きの領域を保有しているかを確認します。
+                 */
+                [[nodiscard]] bool _isShared() const noexcept;
+
+                /**
+                 * @brief 参照カウント付きの領域のうち、値の先頭を取得します。
+                 */
+                [[nodiscard]] std::byte* _sharedValue() const noexcept;
+
+                /**
+                 * @brief 参照カウント付きの領域を保有している場合、参照カウントを増やします。
+                 */
+                void _retain() const noexcept;
+
+                /**
+                 * @brief 参照カウント付きの領域を保有している場合、参照カウントを減らし、0になれば解放します。
+                 */
+                void _release() noexcept;
+
+                union {
+                    bool boolean;
+                    long long signed_integer;
+                    unsigned long long unsigned_integer;
+                    /// STRING_VIEW, RESULT_STRING, LAZY_*の参照先
+                    const char* view;
+                    /// STRING, LONG_DOUBLE(領域に格納する環境のみ), `*_ARRAY`の格納先
+                    _SharedBlock* block;
+                } _payload{};
+
+                /// 下位8ビットに型タグ、上位56ビットに文字列の長さ(直接格納したLONG_DOUBLEの場合は符号と指数部)を格納します。
+                uint64_t _meta = 0;
             };
 
+            static_assert(sizeof(VContainer) == 16);
+
+            friend class ParseResult;
+
             /**
              * @brief インスタンスを新しく生成する。
              * @tparam T 格納する値の型
@@ -333,7 +736,16 @@ namespace net_ln3::cpp_lib {
              * @return オプション名に設定されている型
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] OptionType getOptionType(const std::string& option_name_) const;
+            [[nodiscard]] OptionType getOptionType(std::string_view option_name_) const;
+
+            /**
+             * @brief オプション名に紐づいた型を、1回の検索で取得します。
+             * @details getOptionType()と異なり、登録されている値をそのまま返します。
+             * @param option_name_ 取得したいオプション名
+             * @return 登録されている型へのポインタ。存在しない場合はnullptr
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] const OptionType* findOptionType(std::string_view option_name_) const;
 
             /**
              * @brief 対応するオプションが存在するかを確認します。
@@ -341,7 +753,7 @@ namespace net_ln3::cpp_lib {
              * @return オプション名が存在するかどうか
              * @since v0.1.0-alpha
              */
-            bool isExistOption(const std::string& option_name_) const;
+            bool isExistOption(std::string_view option_name_) const;
 
             /**
              * @brief オプションを新しく登録する。
@@ -363,7 +775,10 @@ namespace net_ln3::cpp_lib {
             bool removeOption(const std::string& option_name_);
 
         private:
-            std::unordered_map<std::string, OptionType> _name_type_table;
+            friend class FrozenOptionTable;
+            friend class Schema;
+
+            StringMap<OptionType> _name_type_table;
         };
 
         /**
@@ -393,7 +808,15 @@ namespace net_ln3::cpp_lib {
              * @return エイリアスに設定されているオプション名
              * @since v0.1.0-alpha
              */
-            [[nodiscard]] std::string getOptionName(const std::string& alias_name_) const;
+            [[nodiscard]] std::string getOptionName(std::string_view alias_name_) const;
+
+            /**
+             * @brief エイリアスに紐づいたオプション名を、コピーせずに1回の検索で取得します。
+             * @param alias_name_ 取得したいエイリアス
+             * @return 登録されているオプション名へのポインタ。存在しない場合はnullptr
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] const std::string* findOptionName(std::string_view alias_name_) const;
 
             /**
              * @brief 対応するエイリアスが存在するかを確認します。
@@ -401,7 +824,7 @@ namespace net_ln3::cpp_lib {
              * @return エイリアスが存在するかどうか
              * @since v0.1.0-alpha
              */
-            bool isExistAlias(const std::string& alias_name_) const;
+            bool isExistAlias(std::string_view alias_name_) const;
 
             /**
              * @brief エイリアスを新しく登録する。
@@ -423,224 +846,1912 @@ namespace net_ln3::cpp_lib {
             bool removeAlias(const std::string& alias_name_);
 
         private:
-            std::unordered_map<std::string, std::string> _name_alias_table;
+            friend class FrozenOptionTable;
+
+            StringMap<std::string> _name_alias_table;
         };
 
         /**
-         * @brief オプションの型を指定しないパーサ
-         * @details `_no_option_mapper`フラグを`true`にすることで、型指定を無効にします。
-         * @since v0.0.1-alpha
-         * @version v0.1.0-alpha 従来の動作をこのモードで使用できるようにしました。
+         * @brief コンパイル時に定義するオプションの名称、型、エイリアスの組です。
+         * @details makeOptionSchema()に配列として渡して使用します。
+         * @details aliasesに指定できるエイリアスは、1つのオプションにつきMAX_OPTION_ALIASES個までです。
+         * @since v0.2.0-alpha
          */
-        ArgumentParser();
+        struct OptionSpec {
+            /// 1つのオプションに指定できるエイリアスの最大数
+            static constexpr size_t MAX_OPTION_ALIASES = 4;
 
-        /**
-         * @brief オプションの型を指定するパーサ
-         * @param type_ オプションの名称と型を紐づけたデータ
-         * @since v0.1.0-alpha
-         */
-        explicit ArgumentParser(OptionNames type_);
+            std::string_view name;
+            OptionType type = OptionType::STRING;
+            std::array<std::string_view, MAX_OPTION_ALIASES> aliases{};
+        };
 
         /**
-         * @brief オプションの型を指定し、それに対してエイリアスを設定するパーサ
-         * @param type_ オプションの名称と型を紐づけたデータ
-         * @param alias_ オプションの名称とその別名を紐づけたデータ
-         * @since v0.1.0-alpha
+         * @brief コンパイル時に作成されたオプションの表を参照するクラスです。
+         * @details StaticOptionSchemaが保持する表を参照します。検索は完全ハッシュにより、メモリを確保せずに定数時間で行われます。
+         * @details 参照先のStaticOptionSchemaは、このインスタンスより長く存在する必要があります。
+         * @since v0.2.0-alpha
          */
-        ArgumentParser(OptionNames type_, OptionAlias alias_);
+        class StaticOptionTable {
+        public:
+            /// 空のスロットを表す値
+            static constexpr uint32_t EMPTY_SLOT = 0xffffffffu;
+
+            constexpr StaticOptionTable(const std::span<const OptionSpec> specs_,
+                                        const std::span<const uint32_t> option_slots_,
+                                        const std::span<const uint32_t> option_displacements_,
+                                        const std::span<const uint32_t> alias_slots_,
+                                        const std::span<const uint32_t> alias_displacements_,
+                                        const uint64_t seed_) noexcept
+                : _specs(specs_), _option_slots(option_slots_), _option_displacements(option_displacements_),
+                  _alias_slots(alias_slots_), _alias_displacements(alias_displacements_), _seed(seed_) {
+            }
 
-        /**
-         * @param argc_ コマンドライン引数の数
-         * @param argv_ char*型のコマンドライン引数の配列
-         * @overload
-         * @since v0.0.1-alpha
-         */
-        void parse(int argc_, char* argv_[]);
+            /**
+             * @brief オプション名に対応する定義を検索します。
+             * @param option_name_ 検索したいオプション名
+             * @return 見つかった定義。存在しない場合はnullptr
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] const OptionSpec* findOption(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief エイリアスが紐づけられたオプションの定義を検索します。
+             * @param alias_name_ 検索したいエイリアス
+             * @return 見つかった定義。存在しない場合はnullptr
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] const OptionSpec* findAlias(std::string_view alias_name_) const noexcept;
+
+            /**
+             * @brief 登録されているすべてのオプションの定義を取得します。
+             * @return オプションの定義の配列
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::span<const OptionSpec> getSpecs() const noexcept { return _specs; }
+
+            /**
+             * @brief 表で使用するハッシュ関数です。(FNV-1aにfmix64を適用したもの)
+             * @param str_ ハッシュ化する文字列
+             * @param seed_ シード値
+             * @return ハッシュ値
+             * @since v0.2.0-alpha
+             */
+            static constexpr uint64_t hash(const std::string_view str_, const uint64_t seed_) noexcept {
+                uint64_t h = 0xcbf29ce484222325ull ^ seed_;
+                for (const char c : str_) {
+                    h ^= static_cast<unsigned char>(c);
+                    h *= 0x100000001b3ull;
+                }
+                return mix(h);
+            }
+
+            /**
+             * @brief ハッシュ値を攪拌します。(fmix64)
+             * @param h_ 攪拌する値
+             * @return 攪拌した値
+             * @since v0.2.0-alpha
+             */
+            static constexpr uint64_t mix(uint64_t h_) noexcept {
+                h_ ^= h_ >> 33;
+                h_ *= 0xff51afd7ed558ccdull;
+                h_ ^= h_ >> 33;
+                h_ *= 0xc4ceb9fe1a85ec53ull;
+                h_ ^= h_ >> 33;
+                return h_;
+            }
+
+            /**
+             * @brief ハッシュ値と変位からスロットの位置を求めます。
+             * @param hash_ キーのハッシュ値
+             * @param displacement_ キーが属するバケットの変位
+             * @param slot_count_ スロットの数(2の累乗)
+             * @return スロットの位置
+             * @since v0.2.0-alpha
+             */
+            static constexpr size_t slotOf(const uint64_t hash_, const uint32_t displacement_,
+                                           const size_t slot_count_) noexcept {
+                return static_cast<size_t>(mix(hash_ + displacement_ * 0x9e3779b97f4a7c15ull)) & (slot_count_ - 1);
+            }
+
+        private:
+            std::span<const OptionSpec> _specs;
+            std::span<const uint32_t> _option_slots;
+            std::span<const uint32_t> _option_displacements;
+            std::span<const uint32_t> _alias_slots;
+            std::span<const uint32_t> _alias_displacements;
+            uint64_t _seed;
+        };
 
         /**
-         * @brief 引数の配列をパースします。
-         * @param args_
-         * @details 引数の配列をパースし、オプションと引数を分けて格納します。
-         * @details valueは任意です。
-         * @details オプションは次の形式を指します。 `--option_name value`
-         * @details エイリアスは次の形式を指します。 `-alias_name value`
-         * @details それ以外は、すべて引数として扱われます。
-         * @since v0.0.1-alpha
-         * @version v0.1.0-alpha パースできるオプションの形式を変更しました。(`key=val -> --key val`)
+         * @brief コンパイル時に作成されるオプションの表です。
+         * @details makeOptionSchema()で作成します。実行時の構築処理は行われません。
+         * @details オプション名とエイリアスのそれぞれについて、完全ハッシュ(hash and displace)の表を保持します。
+         * @tparam N オプションの数
+         * @since v0.2.0-alpha
          */
-        void parse(const std::vector<std::string>& args_);
+        template <size_t N>
+        class StaticOptionSchema {
+        public:
+            /// オプション名の表のスロット数
+            static constexpr size_t OPTION_SLOTS = std::bit_ceil(N * 2 + 1);
+            /// オプション名の表のバケット数
+            static constexpr size_t OPTION_BUCKETS = std::bit_ceil(N / 2 + 1);
+            /// エイリアスの表のスロット数
+            static constexpr size_t ALIAS_SLOTS = std::bit_ceil(N * OptionSpec::MAX_OPTION_ALIASES * 2 + 1);
+            /// エイリアスの表のバケット数
+            static constexpr size_t ALIAS_BUCKETS = std::bit_ceil(N * OptionSpec::MAX_OPTION_ALIASES / 2 + 1);
 
-        /**
-         * @brief 引数のリストを取得します。
-         * @details 順番は、例えば`実行ファイル arg1 --option value arg2 arg3`と入力したならば、リストは、`[arg1, arg2, arg3]`とそのままの順番で返します。
-         * @details オプションは別の関数で取得できます。詳しくは、getOptionを参照してください。
-         * @since v0.1.0-alpha
-         * */
-        const std::vector<std::string>& getArgs() const;
+            /**
+             * @brief オプションの定義から表を作成します。
+             * @details オプション名やエイリアスが重複している場合、コンパイルエラーになります。
+             * @param specs_ オプションの定義
+             * @since v0.2.0-alpha
+             */
+            consteval explicit StaticOptionSchema(const std::array<OptionSpec, N>& specs_) : _specs(specs_) {
+                std::array<std::string_view, N> option_keys{};
+                std::array<uint32_t, N> option_values{};
+                std::array<std::string_view, N * OptionSpec::MAX_OPTION_ALIASES> alias_keys{};
+                std::array<uint32_t, N * OptionSpec::MAX_OPTION_ALIASES> alias_values{};
+                size_t alias_count = 0;
+                for (size_t i = 0; i < N; i++) {
+                    if (_specs[i].name.empty()) { _error("option name must not be empty."); }
+                    option_keys[i] = _specs[i].name;
+                    option_values[i] = static_cast<uint32_t>(i);
+                    for (const auto& alias : _specs[i].aliases) {
+                        if (alias.empty()) { continue; }
+                        alias_keys[alias_count] = alias;
+                        alias_values[alias_count] = static_cast<uint32_t>(i);
+                        alias_count++;
+                    }
+                }
+                // シードを変えながら、すべてのキーを衝突なく配置できる変位を探す。
+                for (_seed = 0; _seed < 64; _seed++) {
+                    if (_build(option_keys, option_values, N, _option_slots, _option_displacements) &&
+                        _build(alias_keys, alias_values, alias_count, _alias_slots, _alias_displacements)) {
+                        return;
+                    }
+                }
+                _error("failed to build a perfect hash table.");
+            }
+
+            /**
+             * @brief この表を参照するStaticOptionTableを取得します。
+             * @return この表を参照するStaticOptionTable
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] constexpr StaticOptionTable getTable() const noexcept {
+                return {_specs, _option_slots, _option_displacements, _alias_slots, _alias_displacements, _seed};
+            }
+
+        private:
+            /**
+             * @brief 不正な定義を報告します。
+             * @details この関数はconstexprでないため、コンパイル時の評価中に呼び出されるとコンパイルエラーになります。
+             * @details 例外が無効な環境でもコンパイルできるよう、`throw`の代わりに使用します。
+             * @param message_ エラーの内容。コンパイルエラーの位置に表示されます。
+             */
+            static void _error(const char* message_) noexcept { static_cast<void>(message_); }
+
+            /**
+             * @brief 1つの完全ハッシュ表を作成します。
+             * @return すべてのキーを配置できたかどうか。キーが重複している場合はコンパイルエラーになります。
+             */
+            template <size_t K, size_t S, size_t B>
+            consteval bool _build(const std::array<std::string_view, K>& keys_,
+                                  const std::array<uint32_t, K>& values_, const size_t count_,
+                                  std::array<uint32_t, S>& slots_, std::array<uint32_t, B>& displacements_) const {
+                slots_.fill(StaticOptionTable::EMPTY_SLOT);
+                displacements_.fill(0);
+                std::array<uint64_t, K> hashes{};
+                std::array<size_t, K> order{};
+                std::array<size_t, B> bucket_sizes{};
+                for (size_t i = 0; i < count_; i++) {
+                    hashes[i] = StaticOptionTable::hash(keys_[i], _seed);
+                    order[i] = i;
+                    bucket_sizes[hashes[i] & (B - 1)]++;
+                }
+                // 要素の多いバケットから配置する。
+                std::sort(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(count_),
+                          [&](const size_t a_, const size_t b_) {
+                              const size_t bucket_a = hashes[a_] & (B - 1), bucket_b = hashes[b_] & (B - 1);
+                              if (bucket_sizes[bucket_a] != bucket_sizes[bucket_b]) {
+                                  return bucket_sizes[bucket_a] > bucket_sizes[bucket_b];
+                              }
+                              return bucket_a < bucket_b;
+                          });
+                for (size_t begin = 0; begin < count_;) {
+                    const size_t bucket = hashes[order[begin]] & (B - 1);
+                    const size_t end = begin + bucket_sizes[bucket];
+                    for (size_t i = begin; i < end; i++) {
+                        for (size_t j = i + 1; j < end; j++) {
+                            if (keys_[order[i]] == keys_[order[j]]) {
+                                _error("duplicate option name or alias.");
+                            }
+                        }
+                    }
+                    bool placed = false;
+                    for (uint32_t d = 0; d < 4096 && !placed; d++) {
+                        placed = true;
+                        for (size_t i = begin; i < end && placed; i++) {
+                            const size_t slot = StaticOptionTable::slotOf(hashes[order[i]], d, S);
+                            if (slots_[slot] != StaticOptionTable::EMPTY_SLOT) { placed = false; }
+                            for (size_t j = begin; j < i && placed; j++) {
+                                if (StaticOptionTable::slotOf(hashes[order[j]], d, S) == slot) { placed = false; }
+                            }
+                        }
+                        if (placed) {
+                            displacements_[bucket] = d;
+                            for (size_t i = begin; i < end; i++) {
+                                slots_[StaticOptionTable::slotOf(hashes[order[i]], d, S)] = values_[order[i]];
+                            }
+                        }
+                    }
+                    if (!placed) { return false; }
+                    begin = end;
+                }
+                return true;
+            }
+
+            std::array<OptionSpec, N> _specs;
+            std::array<uint32_t, OPTION_SLOTS> _option_slots{};
+            std::array<uint32_t, OPTION_BUCKETS> _option_displacements{};
+            std::array<uint32_t, ALIAS_SLOTS> _alias_slots{};
+            std::array<uint32_t, ALIAS_BUCKETS> _alias_displacements{};
+            uint64_t _seed = 0;
+        };
 
         /**
-         * @brief 引数を取得します。
-         * @param i_ 0以上の整数
-         * @return 0から始まるリストのi番目の要素
-         * @details i番目の要素が存在しない場合は、空文字列が返されます。
-         * @since v0.1.0-alpha
+         * @brief オプションの定義から、コンパイル時にオプションの表を作成します。
+         * @details 作成した表は、`static constexpr`な変数に格納し、ArgumentParserのコンストラクタに渡して使用します。
+         * @details ex: `static constexpr auto schema = ArgumentParser::makeOptionSchema({{"help", OptionType::BOOLEAN, {"?"}}});`
+         * @tparam N オプションの数
+         * @param specs_ オプションの定義
+         * @return 作成したオプションの表
+         * @since v0.2.0-alpha
          */
-        std::string getArg(size_t i_) const;
+        template <size_t N>
+        static consteval StaticOptionSchema<N> makeOptionSchema(const OptionSpec (&specs_)[N]) {
+            return StaticOptionSchema<N>(std::to_array(specs_));
+        }
 
         /**
-         * @brief オプションを取得します。
-         * @param option_name_ 取得したいオプションの名称
-         * @param default_ 存在しない場合に返す値
-         * @return OptionValue 取得した引数の値
-         * @details 存在しないオプション名を指定した場合、default_を返します。
-         * @since v0.1.0-alpha
+         * @brief OptionNamesとOptionAliasを1つの連続した表にまとめた、変更不可能な表です。
+         * @details オプション名とエイリアスは、オープンアドレス法(線形探索)のハッシュ表に格納されます。
+         * @details 名称は1つの連続した文字列バッファに格納され、エイリアスはオプションの番号に直接紐づけられます。
+         * @details 紐づけ先のオプションが存在しないエイリアスは、登録されていないオプション名に紐づけられたものとして扱います。
+         * @details オプション名とエイリアスは、それぞれ名称の昇順に並べた連続した索引にも格納されます。
+         * 索引は接頭辞による検索(resolveOptionPrefix(), completeOption()など)に使用します。
+         * @since v0.2.0-alpha
          */
-        OptionValue getOption(const std::string& option_name_,
-                              const OptionValue& default_ = OptionValue()) const;
+        class FrozenOptionTable {
+        public:
+            /**
+             * @brief 検索結果のオプションです。
+             * @since v0.2.0-alpha
+             */
+            struct Entry {
+                std::string_view name;
+                OptionType type;
+                /// オプションが登録されているかどうか。紐づけ先が登録されていないエイリアスの場合はfalse
+                bool registered;
+            };
+
+            /**
+             * @brief 空の表を作成します。
+             * @since v0.2.0-alpha
+             */
+            FrozenOptionTable() = default;
+
+            /**
+             * @brief オプション名とエイリアスから表を作成します。
+             * @param names_ オプションの名称と型を紐づけたデータ
+             * @param alias_ オプションの名称とその別名を紐づけたデータ
+             * @since v0.2.0-alpha
+             */
+            FrozenOptionTable(const OptionNames& names_, const OptionAlias& alias_);
+
+            /**
+             * @brief オプション名に対応するオプションを検索します。
+             * @param option_name_ 検索したいオプション名
+             * @return 見つかったオプション。型は登録された値のままです。存在しない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::optional<Entry> findOption(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief エイリアスに紐づけられたオプションを検索します。
+             * @details 紐づけ先のオプションが登録されていない場合は、Entry::registeredがfalseになります。
+             * @param alias_name_ 検索したいエイリアス
+             * @return 見つかったオプション。存在しない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::optional<Entry> findAlias(std::string_view alias_name_) const noexcept;
+
+            /**
+             * @brief 接頭辞が一致するオプションが1つのみの場合に、そのオプションを取得します。(`--verb`を`--verbose`として扱う場合)
+             * @details prefix_と完全に一致するオプションが存在する場合は、他に一致するオプションがあってもそれを返します。
+             * @details 索引を二分探索するため、計算量は接頭辞の長さと登録数の対数に比例します。
+             * @param prefix_ オプション名の接頭辞
+             * @param ambiguous_ 接頭辞が複数のオプションに一致する場合はtrue、それ以外の場合はfalseが格納されます。
+             * @return 一意に定まったオプション。一致しない場合と、複数に一致する場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::optional<Entry> resolveOptionPrefix(std::string_view prefix_,
+                                                                   bool& ambiguous_) const noexcept;
+
+            /**
+             * @brief 接頭辞が一致するエイリアスが1つのみの場合に、紐づけられたオプションを取得します。
+             * @details 詳細はresolveOptionPrefix()を参照してください。
+             * @param prefix_ エイリアスの接頭辞
+             * @param ambiguous_ 接頭辞が複数のエイリアスに一致する場合はtrue、それ以外の場合はfalseが格納されます。
+             * @return 一意に定まったエイリアスに紐づけられたオプション。一致しない場合と、複数に一致する場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::optional<Entry> resolveAliasPrefix(std::string_view prefix_,
+                                                                  bool& ambiguous_) const noexcept;
+
+            /**
+             * @brief 接頭辞が一致するすべてのオプション名を、名称の昇順でcompletions_の末尾に追加します。
+             * @details 追加する文字列はこの表の名称を参照します。計算量は接頭辞の長さと一致した数に比例します。
+             * @param prefix_ オプション名の接頭辞
+             * @param completions_ 一致したオプション名の追加先
+             * @return 追加したオプション名の数
+             * @since v0.2.0-alpha
+             */
+            size_t completeOption(std::string_view prefix_, std::vector<std::string_view>& completions_) const;
+
+            /**
+             * @brief 接頭辞が一致するすべてのエイリアスを、名称の昇順でcompletions_の末尾に追加します。
+             * @details 詳細はcompleteOption()を参照してください。
+             * @param prefix_ エイリアスの接頭辞
+             * @param completions_ 一致したエイリアスの追加先
+             * @return 追加したエイリアスの数
+             * @since v0.2.0-alpha
+             */
+            size_t completeAlias(std::string_view prefix_, std::vector<std::string_view>& completions_) const;
+
+            /**
+             * @brief 登録されているオプションの数を取得します。
+             * @return オプションの数
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] size_t size() const noexcept;
+
+        private:
+            /// 空のスロットを表す値
+            static constexpr uint32_t _EMPTY_SLOT = 0xffffffffu;
+            /// エイリアスのスロットであることを表すビット
+            static constexpr uint32_t _ALIAS_BIT = 0x80000000u;
+            /// 紐づけ先が登録されていないエイリアスのオプション番号
+            static constexpr uint32_t _UNKNOWN_OPTION = 0x7fffffffu;
+
+            struct _Slot {
+                /// ハッシュ値の上位32ビット
+                uint32_t tag = 0;
+                uint32_t key_offset = 0;
+                uint32_t key_length = 0;
+                /// オプションの番号。エイリアスの場合は_ALIAS_BITが立ちます。
+                uint32_t target = _EMPTY_SLOT;
+            };
+
+            struct _Option {
+                uint32_t name_offset;
+                uint32_t name_length;
+                OptionType type;
+            };
+
+            /**
+             * @brief 名称をバッファに追加し、その位置を返します。
+             */
+            uint32_t _appendName(std::string_view name_);
+
+            /**
+             * @brief スロットを登録します。
+             */
+            void _insert(std::string_view key_, uint32_t target_);
+
+            /**
+             * @brief スロットを検索します。1回の探索で見つかることを想定しています。
+             */
+            [[nodiscard]] const _Slot* _find(std::string_view key_, bool alias_) const noexcept;
+
+            [[nodiscard]] Entry _toEntry(uint32_t option_index_) const noexcept;
+
+            /**
+             * @brief スロットの名称を取得します。
+             */
+            [[nodiscard]] std::string_view _keyOf(uint32_t slot_index_) const noexcept;
+
+            /**
+             * @brief 索引のうち、名称が接頭辞に一致する範囲を検索します。
+             */
+            [[nodiscard]] std::span<const uint32_t> _prefixRange(const std::vector<uint32_t>& index_,
+                                                                 std::string_view prefix_) const noexcept;
+
+            std::vector<_Slot> _slots;
+            /// オプション名のスロットの番号を、名称の昇順に並べた索引
+            std::vector<uint32_t> _option_index;
+            /// エイリアスのスロットの番号を、名称の昇順に並べた索引
+            std::vector<uint32_t> _alias_index;
+            std::vector<_Option> _options;
+            std::string _names;
+            size_t _option_count = 0;
+        };
+
+        class Schema;
+
+        /**
+         * @brief 1回のパースの結果
+         * @details 引数・オプション・無効なオプションの記録を保持します。Schema::parse()で作成します。
+         * @details 異なるスレッドで同時に使用する場合は、スレッドごとに別のインスタンスを使用してください。
+         * @since v0.2.0-alpha
+         */
+        class ParseResult {
+        public:
+            /**
+             * @brief パース中に記録した1件の誤り
+             * @details 誤りは発生した順に1つの配列へ追加され、getInvalidOptions()などで名称ごとにまとめた表は、
+             * 取得する際に作成されます。
+             * @details nameとvalueは、文字列型のオプションの値と同じ規則で格納されます。
+             * Schema::parseView()でパースした場合、引数に含まれるnameとvalueは呼び出し元の文字列を参照します。
+             * (エイリアスや省略形から解決したオプション名は、結果の文字列領域にコピーされます。)
+             */
+            struct Diagnostic {
+                /**
+                 * @brief 誤りの種類
+                 */
+                enum class Kind : uint8_t {
+                    /// 登録されていない、または重複したオプション(getInvalidOptions())
+                    INVALID_OPTION,
+                    /// 値を型に変換できないオプション(getInvalidOptionTypes())
+                    INVALID_OPTION_TYPE,
+                    /// オプションと紐づけられていないエイリアス(getInvalidAlias())
+                    INVALID_ALIAS
+                };
+
+                Kind kind;
+                /// 期待している型。kindがINVALID_OPTION_TYPEの場合のみ有効です。
+                OptionType expected_type;
+                /// 値を表す引数が、パースした引数(展開したレスポンスファイルの内容を含む)の何番目であるか
+                size_t token_index;
+                /// オプション名またはエイリアス名
+                std::string_view name;
+                /// 対象の値
+                std::string_view value;
+                /**
+                 * @brief 配列の型(`*_ARRAY`)の値のうち、最初の不正な要素の番号(0始まり)
+                 * @details 配列の型でない場合はSIZE_MAXです。
+                 */
+                size_t element_index = SIZE_MAX;
+            };
+
+            /**
+             * @brief 空の結果を作成します。
+             * @details 引数・オプションの格納先のコンテナと、コピーした文字列はresource_から確保されます。
+             * @details resource_を指定した場合、文字列型のオプションの値はresource_に確保した文字列を参照する`std::string_view`になります。
+             * @details そのため、resource_はこのインスタンスと、取得したOptionValueより長く存在する必要があります。
+             * @details ただし、getArgs()で作成するコピーと、getInvalidOptions()などで作成する表は既定のメモリリソースを使用します。
+             * @param resource_ 結果の格納に使用するメモリリソース。nullptrの場合は既定のメモリリソースを使用します。
+             */
+            explicit ParseResult(std::pmr::memory_resource* resource_ = nullptr);
+
+            /**
+             * @brief 結果を破棄し、新たにパースできる状態に戻します。
+             * @details 格納先のコンテナの容量と文字列領域は再利用のため保持されます。
+             * @details この関数を呼び出す前にコピーしたインスタンスの結果は、影響を受けません。
+             */
+            void reset();
+
+            /**
+             * @brief 引数のリストを取得します。
+             * @details リストは引数を追加する際に作成されるため、この関数は結果を変更せず、複数のスレッドから同時に呼び出せます。
+             * @details 返す参照は、このインスタンスが存在する間有効です。(引数の追加やreset()の後は、その内容が更新されます。)
+             */
+            [[nodiscard]] const std::vector<std::string>& getArgs() const;
+
+            /**
+             * @brief 引数のリストを、コピーせずに取得します。
+             */
+            [[nodiscard]] std::span<const std::string_view> getArgViews() const;
+
+            /**
+             * @brief i_番目の引数を取得します。存在しない場合は空文字列を返します。
+             */
+            [[nodiscard]] std::string getArg(size_t i_) const;
+
+            /**
+             * @brief オプションを取得します。存在しない場合はdefault_を返します。
+             */
+            [[nodiscard]] OptionValue getOption(std::string_view option_name_,
+                                                const OptionValue& default_ = OptionValue()) const;
+
+            /**
+             * @brief オプションを、コピーせずに1回の検索で取得します。
+             * @return 格納されているOptionValueへのポインタ。存在しない場合はnullptr
+             */
+            [[nodiscard]] const OptionValue* findOption(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief オプションの値を、例外を送出せずに取得します。
+             * @details value_の型と使用できる型はOptionValue::tryGet()と同一です。
+             * @param option_name_ 取得したいオプションの名称
+             * @param value_ 値の格納先。失敗した場合は変更されません。
+             * @return 成功した場合はErrorCode::NONE、存在しない場合はErrorCode::NOT_FOUND、型が異なる場合はErrorCode::TYPE_MISMATCH
+             */
+            template <class T>
+            ErrorCode tryGetOption(const std::string_view option_name_, T& value_) const noexcept {
+                const auto value = findOption(option_name_);
+                return value != nullptr ? value->tryGet(value_) : ErrorCode::NOT_FOUND;
+            }
+
+            /**
+             * @brief 無効なオプション・型が無効なオプション・無効なエイリアスのいずれかが記録されているかを確認します。
+             */
+            [[nodiscard]] bool hasErrors() const noexcept;
+
+            /**
+             * @brief CommandTreeでパースした場合に、選択されたサブコマンドを取得します。
+             * @return サブコマンドの名称を空白で区切った文字列(例: `remote add`)。選択されていない場合は空文字列
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] std::string_view getCommand() const noexcept;
+
+            /**
+             * @brief 文字列の配列(OptionType::STRING_LIST)のオプションの値を、指定された順に取得します。
+             * @details 値は文字列型のオプションの値と同じ規則で格納されますが、
+             * ParseResult()でメモリリソースを指定しない場合も、このインスタンスの文字列領域を参照します。
+             * @details 戻り値は、このインスタンスの破棄・reset()・パースの継続まで有効です。
+             * @param option_name_ 取得したいオプションの名称
+             * @return 値の配列。オプションが指定されていない場合や型が異なる場合は空の配列
+             */
+            [[nodiscard]] std::span<const std::string_view> getStringList(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief 符号付き整数の配列(OptionType::SIGNED_LIST)のオプションの値を、指定された順に取得します。
+             * @details 戻り値の有効期間はgetStringList()と同一です。
+             * @param option_name_ 取得したいオプションの名称
+             * @return 値の配列。オプションが指定されていない場合や型が異なる場合は空の配列
+             */
+            [[nodiscard]] std::span<const long long> getSignedList(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief 符号なし整数の配列(OptionType::UNSIGNED_LIST)のオプションの値を、指定された順に取得します。
+             * @details 戻り値の有効期間はgetStringList()と同一です。
+             * @param option_name_ 取得したいオプションの名称
+             * @return 値の配列。オプションが指定されていない場合や型が異なる場合は空の配列
+             */
+            [[nodiscard]] std::span<const unsigned long long> getUnsignedList(
+                std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief 浮動小数点数の配列(OptionType::LONG_DOUBLE_LIST)のオプションの値を、指定された順に取得します。
+             * @details 戻り値の有効期間はgetStringList()と同一です。
+             * @param option_name_ 取得したいオプションの名称
+             * @return 値の配列。オプションが指定されていない場合や型が異なる場合は空の配列
+             */
+            [[nodiscard]] std::span<const long double> getLongDoubleList(std::string_view option_name_) const noexcept;
+
+            /**
+             * @brief パース中に記録した誤りを、発生した順に取得します。
+             * @details 名称ごとにまとめた表を作成しないため、getInvalidOptions()などより低コストです。
+             */
+            [[nodiscard]] std::span<const Diagnostic> getDiagnostics() const noexcept;
+
+            /**
+             * @brief オプションが存在するか確認します。
+             */
+            [[nodiscard]] bool isExistOption(std::string_view key_) const;
+
+            /**
+             * @brief マッピングできなかったオプションを取得します。
+             * @details 記録した誤り(getDiagnostics())を名称ごとにまとめた表を、最初に呼び出したときに作成します。
+             * 以降の呼び出しでは、前回の呼び出し以降に追加された誤りのみを表に追加します。
+             * 表への追加は排他制御されるため、パース中でなければ複数のスレッドから同時に呼び出せます。
+             * @details 返す参照は、このインスタンスが存在する間有効です。(以降のパースやreset()の後は、その内容が更新されます。)
+             */
+            [[nodiscard]] const std::unordered_map<std::string, std::vector<std::string>>& getInvalidOptions() const;
+
+            /**
+             * @brief 値が指定の型に変更不可能である不正なオプションを取得します。
+             * @details 表の作成はgetInvalidOptions()と同様に行われます。
+             */
+            [[nodiscard]] const std::unordered_map<std::string, std::vector<std::pair<std::string, OptionType>>>&
+            getInvalidOptionTypes() const;
+
+            /**
+             * @brief オプションと紐づけられていなかったエイリアスを取得します。
+             * @details 表の作成はgetInvalidOptions()と同様に行われます。
+             */
+            [[nodiscard]] const std::unordered_map<std::string, std::vector<std::string>>& getInvalidAlias() const;
+
+        private:
+            friend class CommandTree;
+            friend class Schema;
+
+            /**
+             * @brief 複数の値を持つオプションの値の格納先
+             * @details 型に対応する配列のみを使用します。
+             */
+            struct _OptionList {
+                explicit _OptionList(std::pmr::memory_resource* resource_);
+
+                /// 最後に値を追加した際の型
+                OptionType type = OptionType::STRING_LIST;
+                /// Schemaが事前に数えた、これから追加される値の数
+                size_t expected_count = 0;
+                std::pmr::vector<std::string_view> strings;
+                std::pmr::vector<long long> signed_values;
+                std::pmr::vector<unsigned long long> unsigned_values;
+                std::pmr::vector<long double> long_double_values;
+
+                /**
+                 * @brief typeの配列にexpected_countの分の容量を確保し、expected_countを0に戻します。
+                 */
+                void reserveExpected();
+
+                /**
+                 * @brief 値が格納されていないかを確認します。
+                 */
+                [[nodiscard]] bool isEmpty() const noexcept;
+
+                /**
+                 * @brief 格納した値を削除します。容量は保持されます。
+                 */
+                void clear() noexcept;
+            };
+
+            /**
+             * @brief 記録した誤りを、名称ごとにまとめた表
+             */
+            struct _GroupedDiagnostics {
+                std::unordered_map<std::string, std::vector<std::string>> invalid_options;
+                std::unordered_map<std::string, std::vector<std::pair<std::string, OptionType>>> invalid_option_types;
+                std::unordered_map<std::string, std::vector<std::string>> invalid_alias;
+                /// 表に追加済みの誤りの数
+                size_t count = 0;
+            };
+
+            /**
+             * @brief const関数から_GroupedDiagnosticsを作成するための排他制御を含む格納先
+             * @details コピー・ムーブでは表のみを移し、排他制御の状態は引き継ぎません。
+             */
+            struct _GroupedDiagnosticsCache {
+                _GroupedDiagnosticsCache() = default;
+
+                _GroupedDiagnosticsCache(const _GroupedDiagnosticsCache& other_);
+
+                _GroupedDiagnosticsCache(_GroupedDiagnosticsCache&& other_) noexcept;
+
+                _GroupedDiagnosticsCache& operator=(const _GroupedDiagnosticsCache& other_);
+
+                _GroupedDiagnosticsCache& operator=(_GroupedDiagnosticsCache&& other_) noexcept;
+
+                ~_GroupedDiagnosticsCache() = default;
+
+                /// tableへの追加を保護します。
+                mutable std::mutex mutex;
+                _GroupedDiagnostics table;
+            };
+
+            /**
+             * @brief パース中にコピーした文字列を格納する領域
+             * @details 文字列は確保済みのブロックに順番に詰めて格納されます。rewind()はブロックを解放せずに先頭から再利用します。
+             */
+            class _StringArena {
+            public:
+                /**
+                 * @param upstream_ ブロックの確保に使用するメモリリソース
+                 */
+                explicit _StringArena(std::pmr::memory_resource* upstream_);
+
+                _StringArena(const _StringArena&) = delete;
+
+                _StringArena& operator=(const _StringArena&) = delete;
+
+                ~_StringArena();
+
+                /**
+                 * @brief 文字列をコピーします。
+                 * @param str_ コピーする文字列
+                 * @return コピーした文字列の参照。rewind()またはこのインスタンスの破棄まで有効です。
+                 */
+                std::string_view copy(std::string_view str_);
+
+                /**
+                 * @brief 格納した文字列を破棄し、確保済みのブロックを先頭から再利用します。
+                 */
+                void rewind() noexcept;
+
+            private:
+                /// ブロックの最小サイズ
+                static constexpr size_t _MIN_BLOCK_SIZE = 256;
+
+                struct _Block {
+                    char* data;
+                    size_t size;
+                };
+
+                std::pmr::memory_resource* _upstream;
+                std::pmr::vector<_Block> _blocks;
+                /// 現在使用中のブロック
+                size_t _block_index = 0;
+                /// 現在使用中のブロックの使用済みのサイズ
+                size_t _used = 0;
+            };
+
+            /**
+             * @brief パースする文字列の格納方法
+             */
+            enum class _StringStorage {
+                /// 呼び出し元が所有する文字列を参照します。
+                REFERENCE,
+                /// 文字列領域にコピーします。
+                COPY,
+                /// このインスタンスが保持する文字列(マップしたファイルなど)を参照します。
+                RESULT
+            };
+
+            /**
+             * @brief Schema::feed()で、値を待っているオプション
+             * @details 呼び出し元の文字列は次の呼び出しまで有効とは限らないため、名称をコピーして保持します。
+             */
+            struct _PendingOption {
+                /// 次の引数がオプションの値である
+                bool option_value_flag = false;
+                std::string option_name;
+                std::string alias_name;
+                std::optional<OptionType> option_type;
+            };
+
+            /**
+             * @brief オプションを登録します。既に登録されている場合は無効なオプションとして記録します。
+             * @details 既に登録されている値が環境変数・設定ファイルに由来する場合は、その値を置き換えます。
+             * @param option_name_ オプション名
+             * @param value_ オプションの値
+             * @param name_storage_ option_name_の格納方法
+             */
+            void _addOption(std::string_view option_name_, OptionValue value_, _StringStorage name_storage_);
+
+            /**
+             * @brief 引数を登録します。
+             * @param value_ 引数の値
+             * @param storage_ 文字列の格納方法。COPYの場合のみ文字列領域にコピーし、それ以外の場合は参照として格納します。
+             */
+            void _addArgument(std::string_view value_, _StringStorage storage_);
+
+            /**
+             * @brief 格納に使用するメモリリソースを取得します。
+             * @return メモリリソース。指定されていない場合は既定のメモリリソース
+             */
+            [[nodiscard]] std::pmr::memory_resource* _getMemoryResource() const;
+
+            /**
+             * @brief 文字列をこのインスタンスの文字列領域にコピーします。
+             * @details 文字列領域が無い場合と、最後の文字列領域を他のインスタンスと共有している場合は、新たに作成します。
+             * そのため、共有している領域に複数のスレッドから同時に追加することはありません。
+             * @param str_ コピーする文字列
+             * @return コピーした文字列の参照
+             */
+            std::string_view _copyString(std::string_view str_);
+
+            /**
+             * @brief 文字列型のオプションの値を作成します。
+             * @details REFERENCEの場合はstr_の参照を格納します。それ以外の場合は、文字列領域(RESULTの場合はstr_)を参照し、
+             * メモリリソースが指定されていない場合は、取得したOptionValueが所有する文字列へ変換されるよう格納します。
+             * @param str_ オプションの値
+             * @param storage_ 文字列の格納方法
+             * @return 作成した値
+             */
+            OptionValue _makeStringValue(std::string_view str_, _StringStorage storage_);
+
+            /**
+             * @brief 検証済みの文字列を、変換を遅延したオプションの値として作成します。
+             * @details COPYの場合は文字列領域にコピーし、それ以外の場合はstr_を参照します。
+             * 値はコピーされる際に変換されるため、参照先はこのインスタンスと同じ期間だけ存在すれば十分です。
+             * @param str_ type_として有効なオプションの値
+             * @param type_ 変換先の型。SIGNED, UNSIGNED, LONG_DOUBLEのいずれかです。
+             * @param storage_ 文字列の格納方法
+             * @return 作成した値
+             */
+            OptionValue _makeLazyValue(std::string_view str_, OptionType type_, _StringStorage storage_);
+
+            /**
+             * @brief 複数の値を持つオプションの格納先を取得します。存在しない場合は作成します。
+             * @param option_name_ オプション名
+             * @param type_ オプションの型。格納先の型として記録します。
+             */
+            _OptionList& _getOptionList(std::string_view option_name_, OptionType type_);
+
+            /**
+             * @brief 複数の値を持つオプションに値を追加します。
+             * @details 既に追加されている値が環境変数・設定ファイルに由来する場合は、それらを取り除いてから追加します。
+             * @param option_name_ オプション名
+             * @param value_ 追加する値
+             * @param type_ オプションの型。`*_LIST`のいずれかです。
+             * @param storage_ 文字列の格納方法。COPYの場合のみ文字列領域にコピーします。
+             * @return 値を型に変換できた場合はtrue
+             */
+            bool _appendListValue(std::string_view option_name_, std::string_view value_, OptionType type_,
+                                  _StringStorage storage_);
+
+            /**
+             * @brief カンマ区切りの配列を変換し、オプションとして登録します。
+             * @details 要素数を数えて領域を一度だけ確保し、すべての要素をその領域へ直接変換します。
+             * @param option_name_ オプション名
+             * @param value_ カンマ区切りの配列
+             * @param type_ オプションの型。`*_ARRAY`のいずれかです。
+             * @param name_storage_ option_name_の格納方法
+             * @return すべての要素を変換できた場合はSIZE_MAX(ParseUtil::StringValidator::ARRAY_VALID)、
+             * それ以外の場合は最初の不正な要素の番号。不正な場合は登録しません。
+             */
+            size_t _addArrayOption(std::string_view option_name_, std::string_view value_, OptionType type_,
+                                   _StringStorage name_storage_);
+
+            /**
+             * @brief 環境変数・設定ファイルの値を適用している場合は、値を格納したオプションとして記録します。
+             * @param option_name_ 値を格納したオプション名
+             */
+            void _recordFallbackOption(std::string_view option_name_);
+
+            /**
+             * @brief 引数で指定されたオプションが環境変数・設定ファイルに由来する値を持つ場合、その記録を取り除きます。
+             * @details 値を適用している間は何も行いません。(適用中の重複は誤りとして扱います。)
+             * @param option_name_ 引数で指定されたオプション名
+             * @return 記録を取り除いた(呼び出し元が値を置き換える)場合はtrue
+             */
+            bool _takeFallbackOption(std::string_view option_name_);
+
+            /**
+             * @brief 誤りを記録します。
+             * @details 名称と値は、それぞれの格納方法がCOPYの場合のみ文字列領域にコピーします。
+             * @param kind_ 誤りの種類
+             * @param name_ オプション名またはエイリアス名
+             * @param value_ 対象の値
+             * @param type_ 期待している型
+             * @param storage_ value_の格納方法
+             * @param name_storage_ name_の格納方法。Schemaが保持する名称はCOPYを指定します。
+             * @param element_index_ 配列の型の値のうち、最初の不正な要素の番号
+             */
+            void _addDiagnostic(Diagnostic::Kind kind_, std::string_view name_, std::string_view value_,
+                                OptionType type_, _StringStorage storage_, _StringStorage name_storage_,
+                                size_t element_index_ = SIZE_MAX);
+
+            /**
+             * @brief 記録した誤りを名称ごとにまとめた表を取得します。
+             * @details まだ表に追加していない誤りを、排他制御を行って追加してから返します。
+             */
+            [[nodiscard]] const _GroupedDiagnostics& _getGroupedDiagnostics() const;
+
+            /// 格納に使用するメモリリソース。nullptrの場合は既定のメモリリソースを使用します。
+            std::pmr::memory_resource* _memory_resource = nullptr;
+            /// コピーした文字列の格納先。参照先が無効にならないよう、コピーしたインスタンス間で共有します。
+            std::pmr::vector<std::shared_ptr<_StringArena>> _string_arenas;
+            /// オプション以外の引数を保持します。順番を変更せずに格納されます。
+            std::pmr::vector<std::string_view> _arg_views;
+            /// getArgs()で返す引数のコピー。_addArgument()で末尾に追加するため、参照先は解放されません。
+            std::vector<std::string> _args;
+            /// 最後の文字列領域を共有していても追加する。parseBatch()がパース中のみ設定します。
+            bool _append_to_shared_arena = false;
+            /// 展開したレスポンスファイル。引数やオプションの値が参照するため、コピーしたインスタンス間で共有します。
+            std::pmr::vector<std::shared_ptr<const multi_platform::MappedFile>> _mapped_files;
+            /// オプションのデータ。キーは文字列領域、または_mapped_files(設定ファイル)上の名称を参照します。
+            std::pmr::unordered_map<std::string_view, OptionValue, TransparentStringHash, std::equal_to<>> _options;
+            /// 複数の値を持つオプションのデータ。reset()では容量を再利用するため、要素を削除しません。
+            std::pmr::unordered_map<std::pmr::string, _OptionList, TransparentStringHash, std::equal_to<>> _option_lists;
+            /// 記録した誤り。発生した順に格納されます。
+            std::pmr::vector<Diagnostic> _diagnostics;
+            /**
+             * @brief _getGroupedDiagnostics()で作成した表。誤りを末尾から追加するため、参照先は解放されません。
+             * @details const関数から追加するため、複数のスレッドから取得しても競合しないよう排他制御を行います。
+             */
+            mutable _GroupedDiagnosticsCache _grouped_diagnostics;
+            /// これまでにパースした引数の数。Diagnostic::token_indexに使用します。
+            size_t _token_count = 0;
+            /// CommandTreeで選択されたサブコマンド。文字列領域にコピーして格納します。
+            std::string_view _command;
+            /// Schema::feed()で値を待っているオプション
+            _PendingOption _pending;
+            /// 環境変数・設定ファイルの値を適用済みである。reset()で解除され、次のパースの終了時に再び適用されます。
+            bool _fallback_applied = false;
+            /// 環境変数・設定ファイルの値を適用している。Schema::_applyFallbackSources()が適用中のみ設定します。
+            bool _applying_fallback = false;
+            /// 環境変数・設定ファイルに由来する値を持つオプション。以降に引数で指定された場合は、その値で置き換えます。
+            std::pmr::vector<std::string_view> _fallback_options;
+        };
+
+        /**
+         * @brief オプションの設定
+         * @details オプション名・エイリアス・型を保持し、引数の配列をパースしてParseResultを作成します。
+         * @details パース時に状態を変更しないため、1つのインスタンスを複数のスレッドから同時に使用できます。
+         * @details 設定を変更する関数(freeze())は、共有する前に呼び出してください。
+         * @since v0.2.0-alpha
+         */
+        class Schema {
+        public:
+            /// レスポンスファイルの入れ子の深さの上限の既定値
+            static constexpr size_t DEFAULT_RESPONSE_FILE_DEPTH = 16;
+
+            /**
+             * @brief オプションの型を指定しない設定
+             * @details すべてのオプションを文字列として格納します。
+             */
+            Schema();
+
+            /**
+             * @brief オプションの型とエイリアスを指定する設定
+             * @param type_ オプションの名称と型を紐づけたデータ
+             * @param alias_ オプションの名称とその別名を紐づけたデータ
+             */
+            explicit Schema(OptionNames type_, OptionAlias alias_ = {});
+
+            /**
+             * @brief コンパイル時に作成したオプションの表を使用する設定
+             * @details schema_は、このインスタンスより長く存在する必要があります。(`static constexpr`な変数を推奨します。)
+             * @tparam N オプションの数
+             * @param schema_ makeOptionSchema()で作成したオプションの表
+             */
+            template <size_t N>
+            explicit Schema(const StaticOptionSchema<N>& schema_) : _static_option_table(schema_.getTable()),
+                                                                     _option_mapper_mode(true) {
+                for (const auto& spec : _static_option_table->getSpecs()) {
+                    _has_option_lists = _has_option_lists || _isListType(spec.type);
+                }
+            }
+
+            /**
+             * @brief オプション名とエイリアスの表を、検索に適した1つの連続した表(FrozenOptionTable)に変換します。
+             * @details makeOptionSchema()で作成した表を使用している場合は、何もしません。
+             */
+            void freeze();
+
+            /**
+             * @brief `@file`形式の引数を、レスポンスファイルの内容で置き換えるようにします。
+             * @details ファイルはメモリにマップされ、ParseUtil::ShellTokenizerの規則で引数に分割されます。
+             * @details 分割した引数は、引用符や`\`を含まない限りコピーされず、マップした内容を参照したまま格納されます。
+             * マップした内容は、ParseResultが破棄されるか、ParseResult::reset()を呼び出すまで保持されます。
+             * @details レスポンスファイルの中の`@file`も展開されます。相対パスは、そのレスポンスファイルがあるディレクトリを基準とします。
+             * @details ファイルを開けない場合と、入れ子の深さがmax_depth_を超える場合は、`@file`を通常の引数として扱います。
+             * @param max_depth_ 入れ子の深さの上限。0の場合はレスポンスファイルを展開しません。
+             */
+            void enableResponseFiles(size_t max_depth_ = DEFAULT_RESPONSE_FILE_DEPTH);
+
+            /**
+             * @brief 符号付き整数・符号なし整数・浮動小数点数型の値を、パース時に変換せず、取得する際に変換するようにします。
+             * @details パース時には値が型として有効であるかのみを確認し、変換前の文字列を格納します。
+             * 無効な値の扱い(ParseResult::getInvalidOptionType()への記録)は変わりません。
+             * @details 結果に格納された値は変更されず、ParseResult::findOption()で取得した値は取得の度に変換されます。
+             * ParseResult::getOption()などでコピーした値は、コピーの際に一度だけ変換されます。
+             * 多数のオプションのうち一部のみを取得する場合に有効です。
+             * @details 取得時に結果を変更しないため、この設定でパースした結果も複数のスレッドから同時に読み取れます。
+             */
+            void enableLazyConversion();
+
+            /**
+             * @brief 引数で指定されなかったオプションの値を、環境変数から取得するようにします。
+             * @details 名称がprefix_で始まる環境変数を、prefix_を取り除き、英大文字を小文字に、`_`を`-`に置き換えた名称のオプションとして扱います。
+             * 例えば、prefix_が`APP_`の場合、`APP_THREADS`は`--threads`、`APP_OUTPUT_DIR`は`--output-dir`の値になります。
+             * @details 環境変数は、結果に対する最初のパースの終了時(parse(), parseView(), tryParse(), parseCommandLine(), finish())に
+             * 一度だけ走査され、登録されているオプションに対応するものだけが、引数と同じ型の規則で検証・変換されて結果に格納されます。
+             * 同じ結果に続けてパースした場合は、ParseResult::reset()を呼び出すまで再び走査しません。
+             * 値はParseResult::findOption()などで引数の値と同じ表から取得できるため、取得の度に環境変数を検索しません。
+             * @details 引数で指定されたオプションは、環境変数より優先されます。値はパース時にコピーされます。
+             * 環境変数の値を適用した後に同じ結果へ続けてパースした引数で指定された場合も、重複として扱わずに引数の値で置き換えます。
+             * @details 型に変換できない値は、ParseResult::getInvalidOptionTypes()に記録されます。
+             * この場合のDiagnostic::token_indexはSIZE_MAXです。
+             * @details 型を指定しないパーサ(OptionNamesを使用しない場合)では、環境変数を使用しません。
+             * @param prefix_ 対象とする環境変数の名称の接頭辞
+             */
+            void enableEnvironment(std::string prefix_);
+
+            /**
+             * @brief 引数・環境変数で指定されなかったオプションの値を、`key=value`形式の設定ファイルから取得するようにします。
+             * @details ファイルは最初のパースの終了時に一度だけメモリにマップされ、行と`=`の位置はマップした内容の上で検索されます。
+             * キーはオプション名(`--`を除いたもの)で、キーと値の前後の空白は無視されます。空の行と`#`で始まる行は読み飛ばします。
+             * マップした内容と分割した行は、この設定(とそのコピー)でパースするすべての結果で共有されるため、
+             * parseBatch()などで複数の結果を作成しても、ファイルのマップと走査は一度だけ行われます。
+             * そのため、マップした後にファイルを変更しても、結果には反映されません。
+             * @details 値は結果に対する最初のパースの終了時に適用されます。
+             * 環境変数と同様に、続けてパースした引数で指定されたオプションは、ファイルの値を置き換えます。
+             * @details 値は引数と同じ型の規則で検証・変換されます。キーと文字列型の値はコピーされず、マップした内容を参照します。
+             * マップした内容は、それを参照するParseResultが存在する間保持されます。
+             * ParseResult::getOption()などで取得したOptionValueは、文字列を所有します。
+             * @details 優先順位は、引数、環境変数(enableEnvironment())、設定ファイルの順です。
+             * 複数の値を持つオプションは、より優先される指定が無い場合のみ、ファイル内のすべての値が追加されます。
+             * @details 登録されていないキー、`=`を含まない行、ファイル内で重複したキーはParseResult::getInvalidOptions()に、
+             * 型に変換できない値はParseResult::getInvalidOptionTypes()に記録されます。これらのDiagnostic::token_indexはSIZE_MAXです。
+             * @details ファイルを開けない場合は、何も行いません。
+             * @details 型を指定しないパーサ(OptionNamesを使用しない場合)では、設定ファイルを使用しません。
+             * @param path_ 設定ファイルのパス
+             */
+            void enableConfigFile(std::filesystem::path path_);
+
+            /**
+             * @brief 登録されていないオプション名を、接頭辞が一致する唯一のオプションとして扱うようにします。(`--verb`を`--verbose`として扱う)
+             * @details 検索にはfreeze()で作成する名称の索引を使用するため、この関数はfreeze()も呼び出します。
+             * makeOptionSchema()で作成した表を使用している場合は、省略形を使用しません。
+             * @details 完全に一致するオプションは常に優先されます。複数のオプションに一致する省略形は、
+             * 従来通り登録されていないオプションとしてParseResult::getInvalidOptions()に記録されます。
+             * @details エイリアス(`-v`)は省略形として扱いません。
+             */
+            void enableAbbreviation();
+
+            /**
+             * @brief 入力途中の引数を補完する候補を取得します。
+             * @details `--`で始まる場合はオプション名、`-`で始まる場合はエイリアスのうち、接頭辞が一致するものを名称の昇順で追加します。
+             * 追加する名称は接頭辞(`--`, `-`)を含まず、この設定の表を参照します。
+             * @details 候補の検索にはfreeze()で作成した表の索引を使用します。freeze()していない場合は、何も追加しません。
+             * @param token_ 入力途中の引数(例: `--out`)
+             * @param completions_ 候補の追加先
+             * @return 追加した候補の数
+             */
+            size_t complete(std::string_view token_, std::vector<std::string_view>& completions_) const;
+
+            /**
+             * @brief 引数の配列をパースし、新たに作成した結果に格納します。
+             * @details パースの規則はArgumentParser::parse()と同一です。引数と文字列型の値はコピーされます。
+             * @param args_ 引数の配列
+             * @return パースの結果
+             */
+            [[nodiscard]] ParseResult parse(const std::vector<std::string>& args_) const;
+
+            /**
+             * @overload
+             */
+            [[nodiscard]] ParseResult parse(int argc_, const char* const argv_[]) const;
+
+            /**
+             * @brief 引数の配列をパースし、result_に追加します。
+             * @details result_をParseResult::reset()してから渡すことで、格納先の領域を再利用できます。
+             * @details 複数の値を持つオプションが登録されている場合は、事前に引数を走査して指定された回数を数え、
+             * 値の格納先を一度に確保します。(parseView(), tryParse()も同様です。)
+             * @param args_ 引数の配列
+             * @param result_ 結果の格納先
+             */
+            void parse(const std::vector<std::string>& args_, ParseResult& result_) const;
+
+            /**
+             * @overload
+             */
+            void parse(int argc_, const char* const argv_[], ParseResult& result_) const;
+
+            /**
+             * @brief 引数の配列をパースし、result_に追加します。例外は送出しません。
+             * @details パースの規則と文字列の格納方法はparse()と同一です。
+             * @details メモリを確保できなかった場合は、その時点までの結果をresult_に残したままErrorCode::OUT_OF_MEMORYを返します。
+             * 例外が無効な環境では、メモリを確保できなかった場合はプログラムが終了します。
+             * @param args_ 引数の配列
+             * @param result_ 結果の格納先
+             * @return 成功した場合はErrorCode::NONE。
+             * result_に無効なオプションなどが記録されている場合(この呼び出し以前に記録されたものを含む)はErrorCode::INVALID_ARGUMENTS
+             */
+            ErrorCode tryParse(std::span<const std::string_view> args_, ParseResult& result_) const noexcept;
+
+            /**
+             * @overload
+             */
+            ErrorCode tryParse(int argc_, const char* const argv_[], ParseResult& result_) const noexcept;
+
+            /**
+             * @brief 引数の配列を、コピーせずにパースします。
+             * @details 引数と文字列型のオプションの値は、args_の各要素が参照する文字列への`std::string_view`として格納されます。
+             * @details そのため、参照先の文字列は結果を参照し終えるまで破棄・変更してはいけません。
+             * @param args_ 呼び出し元が所有する文字列を参照する引数の配列
+             * @return パースの結果
+             */
+            [[nodiscard]] ParseResult parseView(std::span<const std::string_view> args_) const;
+
+            /**
+             * @overload
+             */
+            [[nodiscard]] ParseResult parseView(int argc_, const char* const argv_[]) const;
+
+            /**
+             * @brief 引数の配列をコピーせずにパースし、result_に追加します。
+             * @param args_ 呼び出し元が所有する文字列を参照する引数の配列
+             * @param result_ 結果の格納先
+             */
+            void parseView(std::span<const std::string_view> args_, ParseResult& result_) const;
+
+            /**
+             * @overload
+             */
+            void parseView(int argc_, const char* const argv_[], ParseResult& result_) const;
+
+            /**
+             * @brief コマンドライン文字列を分割してパースし、result_に追加します。
+             * @details 文字列はParseUtil::ShellTokenizerの規則(POSIXシェルと同様の引用符と`\`)で分割されます。
+             * @details 引数と文字列型の値は、parse()と同様にコピーされます。
+             * @param command_ コマンドライン文字列
+             * @param result_ 結果の格納先
+             */
+            void parseCommandLine(std::string_view command_, ParseResult& result_) const;
+
+            /**
+             * @brief コマンドライン文字列を分割し、コピーせずにパースしてresult_に追加します。
+             * @details 引用符や`\`を含まない引数は、command_を参照する`std::string_view`として格納されます。
+             * そのため、command_は結果を参照し終えるまで破棄・変更してはいけません。
+             * @details 引用符や`\`を取り除いた引数のみ、result_の文字列領域にコピーされます。
+             * @param command_ コマンドライン文字列
+             * @param result_ 結果の格納先
+             */
+            void parseCommandLineView(std::string_view command_, ParseResult& result_) const;
+
+            /**
+             * @brief 引数を1つずつパースし、result_に追加します。
+             * @details 引数を逐次受け取る場合に使用します。すべての引数をfeed()した結果は、parse()で一度にパースした結果と同一です。
+             * @details 引数はコピーされるため、token_は呼び出し後に破棄・変更できます。
+             * @details 値を待っているオプションの名称はresult_に保持され、次の呼び出しで使用されます。
+             * @param token_ 引数
+             * @param result_ 結果の格納先
+             */
+            void feed(std::string_view token_, ParseResult& result_) const;
+
+            /**
+             * @brief feed()によるパースを終了します。
+             * @details 値を待っているオプションは、parse()と同様に破棄されます。
+             * @param result_ 結果の格納先
+             */
+            void finish(ParseResult& result_) const;
+
+            /**
+             * @brief 複数の引数の配列を、複数のスレッドで並列にパースします。
+             * @details 各要素はparse()と同一の規則で独立してパースされ、結果はbatch_と同じ順番で返されます。
+             * @details 要素は一定数ずつ各スレッドに割り当てられます。スレッドは呼び出しごとに作成され、呼び出し元のスレッドも処理に参加します。
+             * @details 同じスレッドでパースした結果は、そのスレッドの文字列領域を共有します。
+             * そのため、文字列領域は同じスレッドでパースしたすべての結果が破棄されるまで解放されません。
+             * @details 返した結果を続けてパースする場合は、共有している文字列領域ではなく、その結果の新たな文字列領域にコピーします。
+             * @details パース中やスレッドの作成時に例外が送出された場合は、すべてのスレッドの終了を待ってから、最初に捕捉した例外を再送出します。
+             * @param batch_ 引数の配列のリスト
+             * @param thread_count_ 使用するスレッドの数。0の場合は`std::thread::hardware_concurrency()`を使用します。
+             * @return batch_の各要素に対応するパース結果
+             */
+            [[nodiscard]] std::vector<ParseResult> parseBatch(std::span<const std::vector<std::string>> batch_,
+                                                              size_t thread_count_ = 0) const;
+
+        private:
+            /// parseBatch()で1回に各スレッドへ割り当てる要素の数
+            static constexpr size_t _BATCH_CHUNK_SIZE = 64;
+
+            /**
+             * @brief マップした設定ファイルと、その内容を行ごとに分割した結果
+             * @details 最初に適用する際に一度だけ作成し、同じ設定でパースするすべての結果とスレッドで共有します。
+             */
+            struct _ConfigFileCache {
+                /**
+                 * @brief 空行とコメントを除いた1行
+                 */
+                struct Line {
+                    /// キー。`=`を含まない行の場合は行全体です。
+                    std::string_view key;
+                    std::string_view value;
+                    /// 行が`=`を含む
+                    bool has_separator;
+                };
+
+                /// マップと分割を一度だけ行うために使用します。
+                std::once_flag once;
+                /// マップしたファイル。開けなかった場合はnullptrです。
+                std::shared_ptr<const multi_platform::MappedFile> file;
+                /// ファイルの行。キーと値はマップした内容を参照します。
+                std::vector<Line> lines;
+            };
+
+            /**
+             * @brief パース中の状態を保持します。
+             */
+            struct _ParseState {
+                /// 次のコマンドライン引数がオプションの値である
+                bool option_value_flag = false;
+                std::string_view option_name;
+                std::string_view alias_name;
+                /// option_nameの型。オプションが存在しない場合はstd::nullopt
+                std::optional<OptionType> option_type;
+                /// 引数や値の文字列の格納方法
+                ParseResult::_StringStorage storage = ParseResult::_StringStorage::REFERENCE;
+                /// option_nameの格納方法。Schemaが保持する名称(エイリアスや省略形を解決した名称)の場合はCOPYです。
+                ParseResult::_StringStorage name_storage = ParseResult::_StringStorage::COPY;
+            };
+
+            /**
+             * @brief コマンドライン文字列を分割してパースします。
+             * @param command_ コマンドライン文字列
+             * @param storage_ 引用符や`\`を含まない引数の格納方法
+             * @param result_ 結果の格納先
+             */
+            void _parseCommandLine(std::string_view command_, ParseResult::_StringStorage storage_,
+                                   ParseResult& result_) const;
+
+            /**
+             * @brief パースを行う関数を呼び出し、結果をエラーコードに変換します。
+             * @details 例外が有効な環境では、`std::bad_alloc`をErrorCode::OUT_OF_MEMORYに変換します。
+             * @param parse_ パースを行う関数
+             * @param result_ 結果の格納先
+             * @return パースの結果を表すエラーコード
+             */
+            template <class F>
+            static ErrorCode _invokeNoexcept(F&& parse_, const ParseResult& result_) noexcept;
+
+            /**
+             * @brief 1つの引数を処理します。レスポンスファイルが有効な場合は、`@file`形式の引数を展開します。
+             * @param arg_ 処理する引数
+             * @param state_ パース中の状態
+             * @param result_ 結果の格納先
+             * @param depth_ 現在のレスポンスファイルの入れ子の深さ
+             * @param directory_ 相対パスの基準となるディレクトリ。空の場合はカレントディレクトリ
+             */
+            void _parseArgument(std::string_view arg_, _ParseState& state_, ParseResult& result_, size_t depth_ = 0,
+                                const std::filesystem::path& directory_ = {}) const;
+
+            /**
+             * @brief 1つの引数を処理します。
+             * @param arg_ 処理する引数
+             * @param state_ パース中の状態
+             * @param result_ 結果の格納先
+             */
+            void _parseToken(std::string_view arg_, _ParseState& state_, ParseResult& result_) const;
+
+            /**
+             * @brief state_が表すオプションの値を処理し、state_を初期状態に戻します。
+             * @details 次の引数(`--name value`)と、引数の`=`以降(`--name=value`)のどちらの値にも使用します。
+             * @param value_ オプションの値
+             * @param state_ パース中の状態
+             * @param result_ 結果の格納先
+             */
+            void _parseOptionValue(std::string_view value_, _ParseState& state_, ParseResult& result_) const;
+
+            /**
+             * @brief 複数のエイリアスをまとめた引数(`-abc`)を検証し、最後のエイリアスに紐づけられたオプションを取得します。
+             * @details すべての文字が登録されたオプションに紐づけられたエイリアスであり、最後以外が真偽型の場合のみ有効です。
+             * @param bundle_ 接頭辞(`-`)を取り除いた引数
+             * @param type_ 最後のエイリアスに紐づけられたオプションの型の格納先。無効な場合はstd::nullopt
+             * @return 最後のエイリアスに紐づけられたオプション名。無効な場合は空文字列
+             */
+            std::string_view _findAliasBundle(std::string_view bundle_, std::optional<OptionType>& type_) const;
+
+            /**
+             * @brief オプションの型を検索します。見つからない場合は、_fallback_schemaを検索します。
+             * @param option_name_ オプション名
+             * @return オプションの型。登録されていない場合はstd::nullopt。NULLITYとして登録されている場合はOptionType()
+             */
+            [[nodiscard]] std::optional<OptionType> _findOptionType(std::string_view option_name_) const;
+
+            /**
+             * @brief オプションの型を検索し、enableAbbreviation()が呼び出されている場合は省略形を展開します。
+             * @param option_name_ オプション名。省略形の場合は、展開したオプション名に置き換えられます。
+             * @return オプションの型。登録されていない場合はstd::nullopt
+             */
+            [[nodiscard]] std::optional<OptionType> _resolveOption(std::string_view& option_name_) const;
+
+            /**
+             * @brief このインスタンスの表のみから、オプションの型を検索します。
+             */
+            [[nodiscard]] std::optional<OptionType> _findOwnOptionType(std::string_view option_name_) const;
+
+            /**
+             * @brief エイリアスを検索し、紐づけられたオプション名と型を取得します。見つからない場合は、_fallback_schemaを検索します。
+             * @param alias_name_ エイリアス名
+             * @param type_ オプションの型の格納先。オプションが登録されていない場合はstd::nullopt
+             * @return オプション名。エイリアスが存在しない場合は空文字列
+             */
+            std::string_view _findAliasTarget(std::string_view alias_name_, std::optional<OptionType>& type_) const;
+
+            /**
+             * @brief このインスタンスの表のみから、エイリアスを検索します。
+             */
+            std::string_view _findOwnAliasTarget(std::string_view alias_name_, std::optional<OptionType>& type_) const;
+
+            /**
+             * @brief 値を検証し、型に変換します。
+             * @details 検証と変換はParseUtil::StringValidatorにより1回の走査で行われ、例外は使用しません。
+             * @details enableLazyConversion()が呼び出されている場合、数値型の値は検証のみを行い、ParseResult::_makeLazyValue()で作成します。
+             * @param value_ オプションの値
+             * @param type_ 変換先の型
+             * @param state_ パース中の状態
+             * @param result_ 結果の格納先。文字列型の値はParseResult::_makeStringValue()で作成します。
+             * @return value_をOptionValueにラップした値。型に変換できない場合はstd::nullopt
+             */
+            std::optional<OptionValue> _convertOptionValue(std::string_view value_, OptionType type_,
+                                                           const _ParseState& state_, ParseResult& result_) const;
+
+            /**
+             * @brief 型が判明しているオプションの値を、型に応じた格納先に追加します。
+             * @details 型に変換できない場合は、ParseResult::Diagnostic::Kind::INVALID_OPTION_TYPEとして記録します。
+             * @param option_name_ オプション名
+             * @param value_ オプションの値
+             * @param type_ オプションの型
+             * @param state_ パース中の状態
+             * @param result_ 結果の格納先
+             */
+            void _storeOptionValue(std::string_view option_name_, std::string_view value_, OptionType type_,
+                                   const _ParseState& state_, ParseResult& result_) const;
+
+            /**
+             * @brief 引数以外の値の取得元(環境変数・設定ファイル)を、優先順位の高い順に適用します。
+             * @details 結果ごとに一度だけ適用します。(reset()を呼び出すまで、以降のパースでは適用しません。)
+             * @param result_ 結果の格納先
+             */
+            void _applyFallbackSources(ParseResult& result_) const;
+
+            /**
+             * @brief enableEnvironment()が呼び出されている場合、環境変数を一度だけ走査し、引数で指定されなかったオプションに格納します。
+             * @param result_ 結果の格納先
+             */
+            void _applyEnvironment(ParseResult& result_) const;
+
+            /**
+             * @brief enableConfigFile()が呼び出されている場合、設定ファイルの値を、指定されなかったオプションに格納します。
+             * @details ファイルのマップと行の分割は_loadConfigFile()で一度だけ行い、ここでは分割済みの行を検証・格納します。
+             * @param result_ 結果の格納先
+             */
+            void _applyConfigFile(ParseResult& result_) const;
+
+            /**
+             * @brief 設定ファイルを一度だけマップし、行ごとに分割します。
+             * @details 複数のスレッドから同時に呼び出した場合も、マップと分割は一度だけ行われます。
+             * @return マップした設定ファイル。開けなかった場合は、fileがnullptrです。
+             */
+            const _ConfigFileCache& _loadConfigFile() const;
+
+            /**
+             * @brief 型が複数の値を持つ型(`*_LIST`)であるかを確認します。
+             */
+            static constexpr bool _isListType(const OptionType type_) noexcept {
+                return type_ == OptionType::STRING_LIST || type_ == OptionType::SIGNED_LIST
+                    || type_ == OptionType::UNSIGNED_LIST || type_ == OptionType::LONG_DOUBLE_LIST;
+            }
+
+            /**
+             * @brief 型がカンマ区切りの配列の型(`*_ARRAY`)であるかを確認します。
+             */
+            static constexpr bool _isArrayType(const OptionType type_) noexcept {
+                return type_ == OptionType::SIGNED_ARRAY || type_ == OptionType::UNSIGNED_ARRAY
+                    || type_ == OptionType::LONG_DOUBLE_ARRAY;
+            }
+
+            /**
+             * @brief 複数の値を持つオプションが指定された回数を数え、格納先の容量を事前に確保します。
+             * @details 複数の値を持つオプションが登録されていない場合は、何もしません。
+             * @tparam R `std::string_view`に変換できる要素の範囲
+             * @param args_ これからパースする引数の配列
+             * @param result_ 結果の格納先
+             */
+            template <class R>
+            void _reserveOptionLists(const R& args_, ParseResult& result_) const;
+
+            /// 有効なオプション名とその型
+            OptionNames _option_names;
+            /// 有効なオプションエイリアス
+            OptionAlias _alias;
+            /// コンパイル時に作成されたオプションの表。設定されている場合は_option_names, _aliasより優先します。
+            std::optional<StaticOptionTable> _static_option_table;
+            /// freeze()で作成した表。設定されている場合は_option_names, _aliasより優先します。
+            std::optional<FrozenOptionTable> _frozen_option_table;
+            /// オプションマッパーを使用して、型の検証・変換を行います。
+            bool _option_mapper_mode = false;
+            /// レスポンスファイルの入れ子の深さの上限。0の場合はレスポンスファイルを展開しません。
+            size_t _response_file_depth = 0;
+            /// 数値型の値の変換を、初めて取得する際まで遅延します。
+            bool _lazy_conversion = false;
+            /// 登録されていないオプション名を、一意な省略形として展開します。
+            bool _abbreviation = false;
+            /// 複数の値を持つオプションが登録されている場合はtrue。_reserveOptionLists()で使用します。
+            bool _has_option_lists = false;
+            /// 値を取得する環境変数の名称の接頭辞。std::nulloptの場合は環境変数を使用しません。
+            std::optional<std::string> _environment_prefix;
+            /// 値を取得する設定ファイルのパス。空の場合は設定ファイルを使用しません。
+            std::filesystem::path _config_file;
+            /// マップした設定ファイル。enableConfigFile()で作成し、コピーしたインスタンス間で共有します。
+            std::shared_ptr<_ConfigFileCache> _config_file_cache;
+            /// オプション・エイリアスが見つからない場合に検索する設定。CommandTreeのグローバルな設定を共有します。
+            std::shared_ptr<const Schema> _fallback_schema;
+
+            friend class CommandTree;
+        };
 
         /**
-         * @brief オプションが存在するか確認します。
-         * @param key_ 取得したいオプションの名前
-         * @return bool オプションが存在したかの結果
-         * @since v0.1.0-alpha
+         * @brief サブコマンド(`tool build --x`, `tool remote add --y`)ごとに設定を持つ、不変の木構造です。
+         * @details 引数の先頭から続く、オプションでもオプションの値でもない引数を、サブコマンドの名称として順に照合します。
+         * 照合できない引数が現れた時点で選択が確定し、以降の引数は選択されたサブコマンドの設定でパースされます。
+         * サブコマンドより前のオプションは、その時点までに選択された設定(最初はグローバルな設定)でパースされます。
+         * @details 各サブコマンドの設定に無いオプション・エイリアスは、グローバルな設定から検索されます。
+         * グローバルな設定は複製されず、すべてのサブコマンドで共有されます。
+         * @details サブコマンドの名称は、構築時に1つの連続した文字単位のトライ木に変換されます。
+         * 照合の計算量は引数の長さのみに依存し、サブコマンドの数には依存しません。
+         * @details 環境変数・設定ファイル(Schema::enableEnvironment(), Schema::enableConfigFile())は、選択された設定のものを使用します。
+         * @details 構築後は変更されないため、1つのインスタンスを複数のスレッドから同時に使用できます。
+         * @since v0.2.0-alpha
          */
-        bool isExistOption(const std::string& key_) const;
+        class CommandTree {
+        public:
+            /**
+             * @brief サブコマンドの定義
+             */
+            struct Command {
+                /// サブコマンドの名称を空白で区切った文字列(例: `remote add`)
+                std::string path;
+                /// このサブコマンドの設定。nullptrの場合は親のサブコマンド(またはグローバル)の設定を使用します。
+                std::shared_ptr<const Schema> schema;
+            };
+
+            /**
+             * @brief サブコマンドの木を構築します。
+             * @details `remote add`のみが定義されている場合、`remote`は設定を持たないサブコマンドとして追加されます。
+             * @details 同じ名称が複数回定義されている場合は、最初の定義を使用します。
+             * @param global_ すべてのサブコマンドで共有する設定。nullptrの場合はオプションの型を指定しない設定を使用します。
+             * @param commands_ サブコマンドの定義
+             */
+            CommandTree(std::shared_ptr<const Schema> global_, std::span<const Command> commands_);
+
+            /**
+             * @brief 引数の配列をパースし、サブコマンドを選択します。
+             * @details 引数と文字列型の値はコピーされます。選択されたサブコマンドはParseResult::getCommand()で取得できます。
+             * @param args_ 引数の配列
+             * @param result_ 結果の格納先
+             */
+            void parse(const std::vector<std::string>& args_, ParseResult& result_) const;
+
+            /**
+             * @overload
+             */
+            void parse(int argc_, const char* const argv_[], ParseResult& result_) const;
+
+            /**
+             * @brief 引数をコピーせずにパースし、サブコマンドを選択します。
+             * @details 格納される文字列はargs_の要素を参照します。詳細はSchema::parseView()を参照してください。
+             * @param args_ 引数の配列
+             * @param result_ 結果の格納先
+             */
+            void parseView(std::span<const std::string_view> args_, ParseResult& result_) const;
+
+            /**
+             * @brief サブコマンドの名称に対応する設定を取得します。
+             * @param path_ サブコマンドの名称を空白で区切った文字列
+             * @return 設定。サブコマンドが存在しない場合はnullptr。設定を持たない場合は親の設定
+             */
+            [[nodiscard]] const Schema* findSchema(std::string_view path_) const;
+
+        private:
+            /**
+             * @brief トライ木の節点
+             * @details 子への辺は_edgesの[first_edge, first_edge + edge_count)に、ラベルの昇順で格納されています。
+             */
+            struct _TrieNode {
+                uint32_t first_edge = 0;
+                uint32_t edge_count = 0;
+                /// この節点で終わるサブコマンドの番号(_commandsの添字)。存在しない場合は-1
+                int32_t command = -1;
+            };
+
+            /**
+             * @brief トライ木の辺
+             */
+            struct _TrieEdge {
+                char label;
+                uint32_t target;
+            };
+
+            /**
+             * @brief 構築後のサブコマンド
+             */
+            struct _Command {
+                std::string path;
+                /// グローバルな設定を_fallback_schemaとして持つ、このサブコマンドの設定
+                std::shared_ptr<const Schema> schema;
+            };
+
+            /// 名称の区切りを表す辺のラベル。引数に含まれない文字を使用します。
+            static constexpr char _SEPARATOR = '\0';
+
+            /**
+             * @brief キー(名称を_SEPARATORで区切った文字列)の昇順に並んだ範囲から、部分木を構築します。
+             * @param keys_ キーとサブコマンドの番号の組
+             * @param depth_ 部分木の根の深さ(共通する接頭辞の長さ)
+             * @return 部分木の根の番号
+             */
+            uint32_t _build(std::span<const std::pair<std::string, int32_t>> keys_, size_t depth_);
+
+            /**
+             * @brief 節点から、ラベルが一致する辺をたどります。
+             * @return 移動先の節点。辺が存在しない場合はstd::nullopt
+             */
+            [[nodiscard]] std::optional<uint32_t> _follow(uint32_t node_, char label_) const;
+
+            /**
+             * @brief 節点の子のサブコマンドのうち、名称がname_であるものを検索します。
+             * @return サブコマンドの節点。存在しない場合はstd::nullopt
+             */
+            [[nodiscard]] std::optional<uint32_t> _findChild(uint32_t node_, std::string_view name_) const;
+
+            /**
+             * @brief サブコマンドを選択しながら引数をパースします。
+             * @tparam R `std::string_view`に変換できる要素の範囲
+             */
+            template <class R>
+            void _parse(const R& args_, ParseResult::_StringStorage storage_, ParseResult& result_) const;
+
+            std::shared_ptr<const Schema> _global;
+            std::vector<_Command> _commands;
+            std::vector<_TrieNode> _nodes;
+            std::vector<_TrieEdge> _edges;
+        };
 
         /**
-         * @brief マッピングできなかったオプションを取得します。
-         * @return マッピングできなかったオプションのオプション名をキーとしたマップ
-         * @since v0.1.0-alpha
+         * @brief オプションの型を指定しないパーサ
+         * @details `_no_option_mapper`フラグを`true`にすることで、型指定を無効にします。
+         * @since v0.0.1-alpha
+         * @version v0.1.0-alpha 従来の動作をこのモードで使用できるようにしました。
          */
-        const std::unordered_map<std::string, std::vector<std::string>>& getInvalidOptions() const;
+        ArgumentParser();
 
         /**
-         * @brief オプション名は存在するが、値が指定の型に変更不可能である不正なオプションを取得します。
-         * @return オプション名をキーとした、値と正常な型のマップ
-         * @since v0.1.0-alpha
+         * @brief オプションの型を指定せず、パース結果をresource_に格納するパーサ
+         * @details 詳細はParseResult::ParseResult()を参照してください。
+         * @param resource_ パース結果の格納に使用するメモリリソース。nullptrの場合は既定のメモリリソースを使用します。
+         * @since v0.2.0-alpha
          */
-        const std::unordered_map<std::string, std::vector<std::pair<std::string, OptionType>>>&
-        getInvalidOptionTypes() const;
+        explicit ArgumentParser(std::pmr::memory_resource* resource_);
 
         /**
-         * @brief オプションと紐づけられていなかったエイリアスを取得します。
-         * @return 紐づけられていなかったエイリアス名をキーとした、値とのマップ
+         * @brief オプションの型を指定するパーサ
+         * @param type_ オプションの名称と型を紐づけたデータ
+         * @param resource_ パース結果の格納に使用するメモリリソース。詳細はParseResult::ParseResult()を参照してください。
          * @since v0.1.0-alpha
+         * @version v0.2.0-alpha メモリリソースを指定できるようにしました。
          */
-        const std::unordered_map<std::string, std::vector<std::string>>& getInvalidAlias() const;
+        explicit ArgumentParser(OptionNames type_, std::pmr::memory_resource* resource_ = nullptr);
 
-    private:
         /**
-         * @brief 引数から取得できる生のオプション名を接頭辞をとったオプション名に変換します。
-         * @param option_arg_ 変換したい生のオプション名
-         * @return 変換後の文字列
+         * @brief オプションの型を指定し、それに対してエイリアスを設定するパーサ
+         * @param type_ オプションの名称と型を紐づけたデータ
+         * @param alias_ オプションの名称とその別名を紐づけたデータ
+         * @param resource_ パース結果の格納に使用するメモリリソース。詳細はParseResult::ParseResult()を参照してください。
          * @since v0.1.0-alpha
+         * @version v0.2.0-alpha メモリリソースを指定できるようにしました。
          */
-        static std::string _getOptionName(const std::string& option_arg_);
+        ArgumentParser(OptionNames type_, OptionAlias alias_, std::pmr::memory_resource* resource_ = nullptr);
 
         /**
-         * @brief 引数から取得できる生のエイリアスを接頭辞をとったエイリアスに変換します。
-         * @param alias_arg_ 変換したい生のエイリアス
-         * @return 変換後の文字列
-         * @since v0.1.0-alpha
+         * @brief コンパイル時に作成したオプションの表を使用するパーサ
+         * @details オプション名とエイリアスの検索は、schema_の表を参照して行われます。
+         * @details schema_は、このインスタンスより長く存在する必要があります。(`static constexpr`な変数を推奨します。)
+         * @tparam N オプションの数
+         * @param schema_ makeOptionSchema()で作成したオプションの表
+         * @param resource_ パース結果の格納に使用するメモリリソース。詳細はParseResult::ParseResult()を参照してください。
+         * @since v0.2.0-alpha
          */
-        static std::string _getAliasName(const std::string& alias_arg_);
+        template <size_t N>
+        explicit ArgumentParser(const StaticOptionSchema<N>& schema_, std::pmr::memory_resource* resource_ = nullptr)
+            : ArgumentParser(std::make_shared<const Schema>(schema_), resource_) {
+        }
 
         /**
-         * @brief 引数がオプション名を表しているかを判定します。
-         * @param option_arg_ 判定したい引数
-         * @return 判定結果
-         * @since v0.1.0-alpha
+         * @brief 作成済みの設定を使用するパーサ
+         * @details 設定はコピーせずに共有されます。
+         * @param schema_ オプションの設定
+         * @param resource_ パース結果の格納に使用するメモリリソース。詳細はParseResult::ParseResult()を参照してください。
+         * @since v0.2.0-alpha
          */
-        static bool _isOptionName(const std::string& option_arg_);
+        explicit ArgumentParser(std::shared_ptr<const Schema> schema_, std::pmr::memory_resource* resource_ = nullptr);
 
         /**
-         * @brief 引数がエイリアスを表しているかを判定します。
-         * @param alias_arg_ 判定したい引数
-         * @return 判定結果
-         * @since v0.1.0-alpha
+         * @param argc_ コマンドライン引数の数
+         * @param argv_ char*型のコマンドライン引数の配列
+         * @overload
+         * @since v0.0.1-alpha
+         */
+        void parse(int argc_, char* argv_[]);
+
+        /**
+         * @brief オプション名とエイリアスの表を、検索に適した1つの連続した表(FrozenOptionTable)に変換します。
+         * @details この関数を呼び出した後は、パース時の検索に変換後の表を使用します。オプションの数が多い場合に有効です。
+         * @details makeOptionSchema()で作成した表を使用している場合は、何もしません。
+         * @details 設定は共有されているため、変換後の表を持つ設定を新たに作成します。
+         * @since v0.2.0-alpha
+         */
+        void freeze();
+
+        /**
+         * @brief `@file`形式の引数を、レスポンスファイルの内容で置き換えるようにします。
+         * @details 詳細はSchema::enableResponseFiles()を参照してください。
+         * @details 設定は共有されているため、変更後の設定を新たに作成します。
+         * @param max_depth_ 入れ子の深さの上限。0の場合はレスポンスファイルを展開しません。
+         * @since v0.2.0-alpha
+         */
+        void enableResponseFiles(size_t max_depth_ = Schema::DEFAULT_RESPONSE_FILE_DEPTH);
+
+        /**
+         * @brief 数値型の値を、パース時に変換せず、取得する際に変換するようにします。
+         * @details 詳細はSchema::enableLazyConversion()を参照してください。
+         * @details 設定は共有されているため、変更後の設定を新たに作成します。
+         * @since v0.2.0-alpha
+         */
+        void enableLazyConversion();
+
+        /**
+         * @brief 引数で指定されなかったオプションの値を、環境変数から取得するようにします。
+         * @details 詳細はSchema::enableEnvironment()を参照してください。
+         * @details 設定は共有されているため、変更後の設定を新たに作成します。
+         * @param prefix_ 対象とする環境変数の名称の接頭辞
+         * @since v0.2.0-alpha
+         */
+        void enableEnvironment(std::string prefix_);
+
+        /**
+         * @brief 引数で指定されなかったオプションの値を、`key=value`形式の設定ファイルから取得するようにします。
+         * @details 詳細はSchema::enableConfigFile()を参照してください。
+         * @details 設定は共有されているため、変更後の設定を新たに作成します。
+         * @param path_ 設定ファイルのパス
+         * @since v0.2.0-alpha
+         */
+        void enableConfigFile(std::filesystem::path path_);
+
+        /**
+         * @brief 登録されていないオプション名を、接頭辞が一致する唯一のオプションとして扱うようにします。
+         * @details 詳細はSchema::enableAbbreviation()を参照してください。
+         * @details 設定は共有されているため、変更後の設定を新たに作成します。
+         * @since v0.2.0-alpha
+         */
+        void enableAbbreviation();
+
+        /**
+         * @brief パース結果を破棄し、新たにパースできる状態に戻します。
+         * @details 引数・オプション・無効なオプションの記録を削除しますが、格納先のコンテナの容量と文字列領域は再利用のため保持されます。
+         * @details オプションの設定(OptionNames, OptionAlias, freeze()で作成した表)は変更されません。
+         * @details 同一の設定で繰り返しパースする場合は、インスタンスを作成し直す代わりにこの関数を使用することで、メモリの確保を抑えることができます。
+         * @details この関数を呼び出す前にコピーしたインスタンスの結果は、影響を受けません。
+         * @since v0.2.0-alpha
+         */
+        void reset();
+
+        /**
+         * @brief オプションの設定を取得します。
+         * @details 取得した設定は、他のパーサやスレッドと共有できます。
+         * @return オプションの設定
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] const std::shared_ptr<const Schema>& getSchema() const;
+
+        /**
+         * @brief パース結果を取得します。
+         * @return パース結果
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] const ParseResult& getResult() const;
+
+        /**
+         * @brief コマンドライン引数を、コピーせずにパースします。
+         * @details 引数と文字列型のオプションの値は、argv_の各要素を参照する`std::string_view`として格納されます。
+         * @details そのため、argv_はこのインスタンスの結果を参照し終えるまで破棄・変更してはいけません。
+         * @details 所有権を持つ文字列が必要な場合は、getArgs()やOptionValue::getString()でコピーを取得してください。
+         * @param argc_ コマンドライン引数の数
+         * @param argv_ char*型のコマンドライン引数の配列
+         * @overload
+         * @since v0.2.0-alpha
+         */
+        void parseView(int argc_, const char* const argv_[]);
+
+        /**
+         * @brief 引数の配列を、コピーせずにパースします。
+         * @details パースの規則はparse()と同一です。
+         * @details 引数と文字列型のオプションの値は、args_の各要素が参照する文字列への`std::string_view`として格納されます。
+         * @details そのため、参照先の文字列はこのインスタンスの結果を参照し終えるまで破棄・変更してはいけません。
+         * @param args_ 呼び出し元が所有する文字列を参照する引数の配列
+         * @since v0.2.0-alpha
+         */
+        void parseView(std::span<const std::string_view> args_);
+
+        /**
+         * @brief コマンドライン文字列を分割してパースします。
+         * @details 文字列はParseUtil::ShellTokenizerの規則(POSIXシェルと同様の引用符と`\`)で分割されます。
+         * @details 引数と文字列型の値は、parse()と同様にコピーされます。
+         * @param command_ コマンドライン文字列
+         * @since v0.2.0-alpha
+         */
+        void parseCommandLine(std::string_view command_);
+
+        /**
+         * @brief コマンドライン文字列を分割し、コピーせずにパースします。
+         * @details 引用符や`\`を含まない引数は、command_を参照する`std::string_view`として格納されます。
+         * そのため、command_はこのインスタンスの結果を参照し終えるまで破棄・変更してはいけません。
+         * @param command_ コマンドライン文字列
+         * @since v0.2.0-alpha
+         */
+        void parseCommandLineView(std::string_view command_);
+
+        /**
+         * @brief 引数を1つずつパースします。
+         * @details 引数を逐次受け取る場合に使用します。すべての引数をfeed()した結果は、parse()で一度にパースした結果と同一です。
+         * @details 引数はコピーされるため、token_は呼び出し後に破棄・変更できます。
+         * @details 引数を受け取り終えたら、finish()を呼び出してください。
+         * @param token_ 引数
+         * @since v0.2.0-alpha
+         */
+        void feed(std::string_view token_);
+
+        /**
+         * @brief feed()によるパースを終了します。
+         * @details 値を待っているオプションは、parse()と同様に破棄されます。
+         * @since v0.2.0-alpha
+         */
+        void finish();
+
+        /**
+         * @brief 引数の配列をパースします。
+         * @param args_
+         * @details 引数の配列をパースし、オプションと引数を分けて格納します。
+         * @details valueは任意です。
+         * @details オプションは次の形式を指します。 `--option_name value`, `--option_name=value`
+         * @details エイリアスは次の形式を指します。 `-alias_name value`
+         * @details 登録されていないエイリアス`-abc`は、各文字が登録されたエイリアスであり、最後以外が真偽型の場合、`-a -b -c`として扱います。
+         * @details 名称と値は引数の上で分割され、一時的な文字列は作成されません。
+         * @details それ以外は、すべて引数として扱われます。
+         * @since v0.0.1-alpha
+         * @version v0.1.0-alpha パースできるオプションの形式を変更しました。(`key=val -> --key val`)
+         * @version v0.2.0-alpha `--key=val`と、まとめて指定したエイリアス(`-abc`)に対応しました。
+         */
+        void parse(const std::vector<std::string>& args_);
+
+        /**
+         * @brief コマンドライン引数を、例外を送出せずにパースします。
+         * @details パースの規則はparse()と同一です。詳細はSchema::tryParse()を参照してください。
+         * @details `-fno-exceptions`でコンパイルした環境でも使用できます。
+         * @param argc_ コマンドライン引数の数
+         * @param argv_ char*型のコマンドライン引数の配列
+         * @return 成功した場合はErrorCode::NONE。無効なオプションなどが記録されている場合はErrorCode::INVALID_ARGUMENTS
+         * @since v0.2.0-alpha
          */
-        static bool _isAliasName(const std::string& alias_arg_);
+        ErrorCode tryParse(int argc_, const char* const argv_[]) noexcept;
 
         /**
-         * @brief オプションを登録します。
-         * @param option_name_ 登録したいオプションの名称
-         * @param value_ オプションの値
+         * @brief 引数の配列を、例外を送出せずにパースします。
+         * @param args_ 引数の配列
+         * @return 成功した場合はErrorCode::NONE。無効なオプションなどが記録されている場合はErrorCode::INVALID_ARGUMENTS
+         * @overload
+         * @since v0.2.0-alpha
+         */
+        ErrorCode tryParse(std::span<const std::string_view> args_) noexcept;
+
+        /**
+         * @brief 引数のリストを取得します。
+         * @details 順番は、例えば`実行ファイル arg1 --option value arg2 arg3`と入力したならば、リストは、`[arg1, arg2, arg3]`とそのままの順番で返します。
+         * @details オプションは別の関数で取得できます。詳しくは、getOptionを参照してください。
+         * @details 引数はパースの際にコピーされます。コピーが不要な場合は、getArgViews()を使用してください。
+         * @details 返す参照は、以降のパースの後も有効です。
          * @since v0.1.0-alpha
+         * */
+        const std::vector<std::string>& getArgs() const;
+
+        /**
+         * @brief 引数のリストを、コピーせずに取得します。
+         * @details 順番はgetArgs()と同一です。
+         * @details parseView()でパースした引数は呼び出し元の文字列を、parse()でパースした引数はこのインスタンスが保持する文字列を参照します。
+         * @return 引数の参照のリスト
+         * @since v0.2.0-alpha
          */
-        void _addOption(const std::string& option_name_, OptionValue value_);
+        [[nodiscard]] std::span<const std::string_view> getArgViews() const;
 
         /**
-         * @brief 引数を登録します。
-         * @param value_ 引数の値
+         * @brief 引数を取得します。
+         * @param i_ 0以上の整数
+         * @return 0から始まるリストのi番目の要素
+         * @details i番目の要素が存在しない場合は、空文字列が返されます。
          * @since v0.1.0-alpha
          */
-        void _addArgument(const std::string& value_);
+        std::string getArg(size_t i_) const;
 
         /**
-         * @brief 無効なオプションを登録します。
-         * @param option_name_ 無効であったオプション名
-         * @param value_ オプションの値
+         * @brief オプションを取得します。
+         * @param option_name_ 取得したいオプションの名称
+         * @param default_ 存在しない場合に返す値
+         * @return OptionValue 取得した引数の値
+         * @details 存在しないオプション名を指定した場合、default_を返します。
          * @since v0.1.0-alpha
          */
-        void _addInvalidOption(const std::string& option_name_, const std::string& value_);
+        OptionValue getOption(std::string_view option_name_,
+                              const OptionValue& default_ = OptionValue()) const;
+
+        /**
+         * @brief オプションを、コピーせずに1回の検索で取得します。
+         * @param option_name_ 取得したいオプションの名称
+         * @return 格納されているOptionValueへのポインタ。存在しない場合はnullptr
+         * @details 戻り値は、このインスタンスが次にパースを行うか、破棄されるまで有効です。
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] const OptionValue* findOption(std::string_view option_name_) const noexcept;
+
+        /**
+         * @brief 複数の値を持つオプションの値を、コピーせずに取得します。
+         * @details 詳細はParseResult::getStringList()などを参照してください。
+         * @details 戻り値は、このインスタンスが次にパースを行うか、破棄されるまで有効です。
+         * @param option_name_ 取得したいオプションの名称
+         * @return 値の配列。オプションが指定されていない場合や型が異なる場合は空の配列
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] std::span<const std::string_view> getStringList(std::string_view option_name_) const noexcept;
+
+        /**
+         * @copydoc getStringList()
+         */
+        [[nodiscard]] std::span<const long long> getSignedList(std::string_view option_name_) const noexcept;
+
+        /**
+         * @copydoc getStringList()
+         */
+        [[nodiscard]] std::span<const unsigned long long> getUnsignedList(std::string_view option_name_) const noexcept;
+
+        /**
+         * @copydoc getStringList()
+         */
+        [[nodiscard]] std::span<const long double> getLongDoubleList(std::string_view option_name_) const noexcept;
+
+        /**
+         * @brief オプションの値を、例外を送出せずに取得します。
+         * @details value_の型は`long long`, `unsigned long long`, `long double`, `bool`, `std::string_view`のいずれかです。
+         * @param option_name_ 取得したいオプションの名称
+         * @param value_ 値の格納先。失敗した場合は変更されません。
+         * @return 成功した場合はErrorCode::NONE、存在しない場合はErrorCode::NOT_FOUND、型が異なる場合はErrorCode::TYPE_MISMATCH
+         * @since v0.2.0-alpha
+         */
+        template <class T>
+        ErrorCode tryGetOption(const std::string_view option_name_, T& value_) const noexcept {
+            return _result.tryGetOption(option_name_, value_);
+        }
 
         /**
-         * @brief 型が無効であったオプション名を登録します。
-         * @param option_name_ 型が無効であったオプション名
-         * @param value_ 型に変換できなかった文字列
-         * @param type_ 期待されている型
+         * @brief オプションが存在するか確認します。
+         * @param key_ 取得したいオプションの名前
+         * @return bool オプションが存在したかの結果
          * @since v0.1.0-alpha
          */
-        void _addInvalidOptionType(const std::string& option_name_, const std::string& value_, OptionType type_);
+        bool isExistOption(std::string_view key_) const;
 
         /**
-         * @brief オプション名と紐づけがされていなかったエイリアスを登録します。
-         * @param alias_name_ 紐づけがされていなかったエイリアス名
-         * @param value_ エイリアスに指定されていた値
+         * @brief マッピングできなかったオプションを取得します。
+         * @return マッピングできなかったオプションのオプション名をキーとしたマップ
          * @since v0.1.0-alpha
          */
-        void _addInvalidAlias(const std::string& alias_name_, const std::string& value_);
+        const std::unordered_map<std::string, std::vector<std::string>>& getInvalidOptions() const;
 
         /**
-         * @brief 文字列がOptionTypeに適合しているかを判定します。
-         * @param value_ 判定したい文字列
-         * @param type_ 判定したい対象の型
-         * @return 判定結果
+         * @brief オプション名は存在するが、値が指定の型に変更不可能である不正なオプションを取得します。
+         * @return オプション名をキーとした、値と正常な型のマップ
          * @since v0.1.0-alpha
          */
-        static bool _isValidType(const std::string& value_, OptionType type_);
+        const std::unordered_map<std::string, std::vector<std::pair<std::string, OptionType>>>&
+        getInvalidOptionTypes() const;
 
         /**
-         * @brief 文字列をtype_に変換し、OptionValueにラップします。
-         * @param value_ 対象文字列
-         * @param type_ 変換対象の型
-         * @return value_をOptionValueにラップした値。
+         * @brief オプションと紐づけられていなかったエイリアスを取得します。
+         * @return 紐づけられていなかったエイリアス名をキーとした、値とのマップ
          * @since v0.1.0-alpha
          */
-        static OptionValue _convertOptionValue(const std::string& value_, OptionType type_);
-
-        /// オプション以外の引数を保持します。順番を変更せずに格納されます。
-        std::vector<std::string> _args;
-        /// オプションのデータ
-        std::unordered_map<std::string, OptionValue> _options;
-        /// 無効なオプションのデータ
-        std::unordered_map<std::string, std::vector<std::string>> _invalid_options;
-        /// 型が無効なオプションのデータ
-        std::unordered_map<std::string, std::vector<std::pair<std::string /* 対象のオプション値の文字列 */, OptionType
-                                                              /* オプションが期待している型 */>>> _invalid_option_types;
-        /// 無効なエイリアスのデータ
-        std::unordered_map<std::string, std::vector<std::string>> _invalid_alias;
-        /// 有効なオプション名とその型
-        OptionNames _valid_option_names;
-        /// 有効なオプションエイリアス
-        OptionAlias _valid_alias;
-        /// オプションマッパーを使用せず、従来の方法で登録を行います。
-        bool _option_mapper_mode;
-
-        static const std::regex _option_name_pattern;
-        static const std::regex _alias_name_pattern;
-        static const std::regex _extract_option_name_pattern;
-        static const std::regex _extract_alias_name_pattern;
+        const std::unordered_map<std::string, std::vector<std::string>>& getInvalidAlias() const;
+
+        /**
+         * @brief 引数がオプション、エイリアス、それ以外の引数のいずれであるかを判定します。
+         * @details 正規表現を使用せず、1回の走査で判定します。判定結果は従来の`--.+`, `-.+`への一致と同一です。
+         * @details そのため、接頭辞以降に改行文字(`\n`, `\r`)を含む場合は、ARGUMENTとして扱われます。
+         * @details この関数はメモリを確保しません。
+         * @param arg_ 判定したい引数
+         * @return 引数の種類と、接頭辞を取り除いた名称の開始位置
+         * @since v0.2.0-alpha
+         */
+        static TokenClass classifyToken(std::string_view arg_) noexcept;
+
+    private:
+        /**
+         * @brief オプションの型を指定しない設定を取得します。
+         * @details すべてのインスタンスで共有されるため、作成時にメモリを確保しません。
+         * @return オプションの型を指定しない設定
+         * @since v0.2.0-alpha
+         */
+        static const std::shared_ptr<const Schema>& _getDefaultSchema();
+
+        /// オプションの設定。コピーしたインスタンス間で共有し、変更する場合は新たに作成します。
+        std::shared_ptr<const Schema> _schema;
+        /// パース結果
+        ParseResult _result;
     };
 } // namespace net_ln3::cpp_lib
 
@@ -30,14 +30,18 @@
 #ifndef NAND2TETRIS_C_LANGUAGE_PARSEUTIL_H
 #define NAND2TETRIS_C_LANGUAGE_PARSEUTIL_H
 
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 #include <stdexcept>
 #include <regex>
 #include <numeric>
+#include <optional>
 #include <set>
+#include <span>
 
 namespace net_ln3::cpp_lib {
     /**
@@ -140,7 +144,9 @@ namespace net_ln3::cpp_lib {
          * @brief 文字列が、整数や真偽型に変換可能かどうかを判定します。
          * @details このクラスのメンバ関数はすべて静的関数です。
          * @details このクラスはインスタンス化できません。
+         * @details 判定と変換は`std::from_chars`により1回の走査で行われます。正規表現や例外は使用せず、ロケールの影響も受けません。
          * @since v0.1.0-alpha
+         * @version v0.2.0-alpha 正規表現と例外を使用しないようにしました。判定結果は従来と同一です。
          * */
         class StringValidator {
         public:
@@ -148,65 +154,201 @@ namespace net_ln3::cpp_lib {
 
             /**
              * @brief 入力がlong long型に変換可能かを判定します。
+             * @details 受け入れる形式は`[+-]?(([1-9][0-9]*)|0)`で、long longの範囲内の値です。
              * @param str_ 符号付き整数を表した文字列
              * @return 判定結果
              * @since v0.1.0-alpha
-             * @throws std::regex_error メモリが不足している場合に投げられます。詳細は`std::regex_match`のドキュメントを確認してください。
+             * @version v0.2.0-alpha 引数を`std::string_view`に変更しました。
              */
-            [[maybe_unused]] static bool isValidSigned(const std::string& str_);
+            [[maybe_unused]] static bool isValidSigned(std::string_view str_) noexcept;
 
             /**
              * @brief 入力がunsigned long long型に変換可能かを判定します。
+             * @details 受け入れる形式は`\+?(([1-9][0-9]*)|0)`で、unsigned long longの範囲内の値です。
              * @param str_ 符号なし整数を表した文字列
              * @return 判定結果
              * @since v0.1.0-alpha
-             * @throws std::regex_error メモリが不足している場合に投げられます。詳細は`std::regex_match`のドキュメントを確認してください。
+             * @version v0.2.0-alpha 引数を`std::string_view`に変更しました。
              */
-            [[maybe_unused]] static bool isValidUnsigned(const std::string& str_);
+            [[maybe_unused]] static bool isValidUnsigned(std::string_view str_) noexcept;
 
             /**
              * @brief 入力が`long double`型に変換可能かを判定します。
+             * @details 受け入れる形式は`[+-]?(([1-9][0-9]*)|0)(\.[0-9]+)?(e[+-]?(([1-9][0-9]{0,3})|0))?`で、`long double`の範囲内の値です。
              * @param str_ 倍精度浮動小数点数を表した文字列
              * @return 判定結果
              * @since v0.1.0-alpha
-             * @throws std::regex_error メモリが不足している場合に投げられます。詳細は`std::regex_match`のドキュメントを確認してください。
+             * @version v0.2.0-alpha 引数を`std::string_view`に変更しました。
              */
-            [[maybe_unused]] static bool isValidLongDouble(const std::string& str_);
+            [[maybe_unused]] static bool isValidLongDouble(std::string_view str_) noexcept;
 
             /**
              * @brief 入力が`double`型に変換可能かを判定します。
+             * @details 受け入れる形式はisValidLongDouble()と同様ですが、指数部は3桁までです。
              * @param str_ 倍精度浮動小数点数を表した文字列
              * @return 判定結果
              * @since v0.1.0-alpha
-             * @throws std::regex_error メモリが不足している場合に投げられます。詳細は`std::regex_match`のドキュメントを確認してください。
+             * @version v0.2.0-alpha 引数を`std::string_view`に変更しました。
              */
-            [[maybe_unused]] static bool isValidDouble(const std::string& str_);
+            [[maybe_unused]] static bool isValidDouble(std::string_view str_) noexcept;
 
             /**
              * @brief 入力が真偽型を表現しているかを判定します。
              * @param str_ 真偽を表した文字列(trueまたはfalse, 文字の大小は無視されます。[ignore case])
              * @return 判定結果
              * @since v0.1.0-alpha
-             * @throws std::regex_error メモリが不足している場合に投げられます。詳細は`std::regex_match`のドキュメントを確認してください。
+             * @version v0.2.0-alpha 引数を`std::string_view`に変更しました。
              */
-            [[maybe_unused]] static bool isValidBoolean(const std::string& str_);
+            [[maybe_unused]] static bool isValidBoolean(std::string_view str_) noexcept;
+
+            /**
+             * @brief 入力を検証し、long long型に変換します。
+             * @details 受け入れる形式はisValidSigned()と同一です。
+             * @param str_ 符号付き整数を表した文字列
+             * @return 変換した値。変換できない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static std::optional<long long> parseSigned(std::string_view str_) noexcept;
+
+            /**
+             * @brief 入力を検証し、unsigned long long型に変換します。
+             * @details 受け入れる形式はisValidUnsigned()と同一です。
+             * @param str_ 符号なし整数を表した文字列
+             * @return 変換した値。変換できない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static std::optional<unsigned long long> parseUnsigned(std::string_view str_) noexcept;
+
+            /**
+             * @brief 入力を検証し、`long double`型に変換します。
+             * @details 受け入れる形式はisValidLongDouble()と同一です。`double`を経由しないため、精度は失われません。
+             * @param str_ 浮動小数点数を表した文字列
+             * @return 変換した値。変換できない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static std::optional<long double> parseLongDouble(std::string_view str_) noexcept;
+
+            /**
+             * @brief 入力を検証し、`double`型に変換します。
+             * @details 受け入れる形式はisValidDouble()と同一です。
+             * @param str_ 浮動小数点数を表した文字列
+             * @return 変換した値。変換できない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static std::optional<double> parseDouble(std::string_view str_) noexcept;
+
+            /**
+             * @brief 入力を検証し、真偽型に変換します。
+             * @details 文字の大小は無視されます。
+             * @param str_ 真偽を表した文字列
+             * @return 変換した値。変換できない場合はstd::nullopt
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static std::optional<bool> parseBoolean(std::string_view str_) noexcept;
+
+            /// parse*Array()が、すべての要素を変換できた場合に返す値
+            static constexpr size_t ARRAY_VALID = SIZE_MAX;
+
+            /**
+             * @brief カンマ区切りの配列の要素数を数えます。
+             * @details SSE2またはAVX2が使用できる場合は、複数のバイトを一度に判定します。
+             * @param str_ カンマ区切りの配列を表した文字列
+             * @return カンマの数に1を加えた値。空文字列の場合も1です。
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static size_t countArrayElements(std::string_view str_) noexcept;
+
+            /**
+             * @brief カンマ区切りの符号付き整数の配列を検証し、values_に変換します。
+             * @details 各要素の形式はisValidSigned()と同一です。要素の前後の空白は許可されません。
+             * @details 18桁以下の要素は、8桁ずつ64ビット整数の演算でまとめて検証・変換します。(SWAR)
+             * @param str_ カンマ区切りの配列を表した文字列
+             * @param values_ 変換した値の格納先。要素数はcountArrayElements(str_)と同一である必要があります。
+             * @return すべての要素を変換できた場合はARRAY_VALID、それ以外の場合は最初の不正な要素の番号(0始まり)
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static size_t parseSignedArray(std::string_view str_, std::span<long long> values_) noexcept;
+
+            /**
+             * @brief カンマ区切りの符号なし整数の配列を検証し、values_に変換します。
+             * @details 各要素の形式はisValidUnsigned()と同一です。変換の方法はparseSignedArray()と同一です。
+             * @param str_ カンマ区切りの配列を表した文字列
+             * @param values_ 変換した値の格納先。要素数はcountArrayElements(str_)と同一である必要があります。
+             * @return すべての要素を変換できた場合はARRAY_VALID、それ以外の場合は最初の不正な要素の番号(0始まり)
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static size_t parseUnsignedArray(std::string_view str_,
+                                                           std::span<unsigned long long> values_) noexcept;
+
+            /**
+             * @brief カンマ区切りの浮動小数点数の配列を検証し、values_に変換します。
+             * @details 各要素の形式はisValidLongDouble()と同一です。
+             * @param str_ カンマ区切りの配列を表した文字列
+             * @param values_ 変換した値の格納先。要素数はcountArrayElements(str_)と同一である必要があります。
+             * @return すべての要素を変換できた場合はARRAY_VALID、それ以外の場合は最初の不正な要素の番号(0始まり)
+             * @since v0.2.0-alpha
+             */
+            [[nodiscard]] static size_t parseLongDoubleArray(std::string_view str_,
+                                                             std::span<long double> values_) noexcept;
+        };
+
+        /**
+         * @brief 文字列をシェルと同様の規則で引数に分割します。
+         * @details 空白文字(スペース、タブ、改行など)で区切られた部分を1つの引数とします。
+         * @details 引用符と`\`は次の規則で取り除かれます。
+         * - `'...'`: 内側の文字をそのまま扱います。
+         * - `"..."`: 内側の文字をそのまま扱います。ただし、`\"`, `\\`, `\$`, `` \` ``はそれぞれ`"`, `\`, `$`, `` ` ``になります。
+         * - 引用符の外側の`\`: 次の1文字をそのまま扱います。
+         * - `\`の直後の改行: 行の継続として、`\`と改行を取り除きます。空白の後の行の継続は、空の引数になりません。
+         * @details 閉じられていない引用符は、入力の終端で閉じられたものとして扱います。
+         * @details 引用符や`\`を含まない引数は、入力を参照する`std::string_view`として取得できます。
+         * 含む場合のみ、内部のバッファに変換後の引数を作成します。
+         * @details 区切り文字・引用符・`\`の検索は、AVX2またはSSE2が有効な環境では複数のバイトを一度に判定します。
+         * (それ以外の環境では1バイトずつ判定します。)
+         * @since v0.2.0-alpha
+         */
+        class ShellTokenizer {
+        public:
+            /**
+             * @param input_ 分割対象の文字列。このインスタンスの使用を終えるまで破棄・変更してはいけません。
+             */
+            explicit ShellTokenizer(std::string_view input_);
+
+            /**
+             * @brief 次の引数へ進みます。
+             * @return 引数が存在した場合はtrue、入力の終端に達した場合はfalse
+             */
+            bool next();
+
+            /**
+             * @brief 現在の引数を取得します。
+             * @details isUnescaped()がtrueの場合、戻り値は内部のバッファを参照するため、次にnext()を呼び出すまで有効です。
+             * @details それ以外の場合は、入力を参照します。
+             * @return 引用符と`\`を取り除いた引数
+             */
+            [[nodiscard]] std::string_view getToken() const;
+
+            /**
+             * @brief 現在の引数が、引用符や`\`を取り除くために内部のバッファに作成されたものかを取得します。
+             * @return 内部のバッファに作成された場合はtrue
+             */
+            [[nodiscard]] bool isUnescaped() const;
 
         private:
             /**
-             * @brief 判定器用のヘルパー関数
-             * @param str_ 判定対象の文字列
-             * @param _error_checker 変換不可の場合に例外を送出するか、それについての真偽型を返す関数。例外でエラーを示す場合は、return true;としてください。
-             * @return 判定結果
-             * @since v0.1.0-alpha
+             * @brief 引用符や`\`を含む引数を、内部のバッファに作成します。
+             * @param begin_ 引数の開始位置
+             * @return 引数を作成した場合はtrue。行の継続(`\`と改行)のみで引用符を含まない場合は、空白として扱いfalse
              */
-            static bool _validateHelper(const std::string& str_,
-                                        const std::function<bool(const std::string&)>& _error_checker) noexcept;
+            bool _unescape(size_t begin_);
 
-            const static std::regex _signedPattern;
-            const static std::regex _unsignedPattern;
-            const static std::regex _longDoublePattern;
-            const static std::regex _doublePattern;
-            const static std::regex _booleanPattern;
+            std::string_view _input;
+            /// 次に読み込む位置
+            size_t _position = 0;
+            /// 引用符や`\`を取り除いた引数の格納先
+            std::string _buffer;
+            std::string_view _token;
+            bool _unescaped = false;
         };
     };
 }
@@ -31,11 +31,45 @@
 #ifndef MULTI_PLATFORM_UTIL_H
 #define MULTI_PLATFORM_UTIL_H
 
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <string_view>
+#include <utility>
+
+/**
+ * @brief 例外が有効な環境であるかを表すマクロです。
+ * @details `-fno-exceptions`(MSVCでは`/EHsc`の指定なし)で例外を無効にしてコンパイルした場合は0になります。
+ * @since v0.2.0-alpha
+ */
+#if defined(__cpp_exceptions) || defined(_CPPUNWIND)
+#define NET_LN3_CPP_LIB_EXCEPTIONS 1
+#else
+#define NET_LN3_CPP_LIB_EXCEPTIONS 0
+#endif
+
 /**
  * @brief マルチプラットフォーム対応用のクラスや関数の名前空間
  * @since v0.1.3-alpha
  */
 namespace net_ln3::cpp_lib::multi_platform {
+    /**
+     * @brief 例外を送出します。例外が無効な環境では、プログラムを異常終了させます。
+     * @details 例外が無効な環境でもコンパイルできるよう、ライブラリ内の`throw`はこの関数を経由します。
+     * @tparam E 例外の型
+     * @param exception_ 送出する例外
+     * @since v0.2.0-alpha
+     */
+    template <class E>
+    [[noreturn]] void raise(E&& exception_) {
+#if NET_LN3_CPP_LIB_EXCEPTIONS
+        throw std::forward<E>(exception_);
+#else
+        static_cast<void>(exception_);
+        std::abort();
+#endif
+    }
+
     /**
      * @brief このクラスのインスタンスをmain関数で作成することで、自動的にコードページを変更できます。
      * @details [詳細なコード例](docs/examples/CodePageGuard.md)
@@ -138,6 +172,63 @@ namespace net_ln3::cpp_lib::multi_platform {
          */
         static unsigned long _getConsoleMode();
     };
+
+    /**
+     * @brief 現在のプロセスの環境変数の配列を取得します。
+     * @details 各要素は`NAME=value`形式の文字列で、配列の終端はnullptrです。
+     * @details 戻り値は、環境変数を変更する関数(`setenv`, `putenv`など)を呼び出すと無効になる場合があります。
+     * @return 環境変数の配列。取得できない場合はnullptr
+     * @note Windows環境では`_environ`、それ以外の環境では`environ`を返します。
+     * @since v0.2.0-alpha
+     */
+    [[nodiscard]] const char* const* getEnvironment() noexcept;
+
+    /**
+     * @brief ファイルを読み取り専用でメモリにマップするクラス。
+     * @details マップした内容は、このインスタンスが破棄されるまで参照できます。
+     * @details 空のファイルはマップせず、空の内容として扱います。
+     * @note Windows環境ではMapViewOfFile、それ以外の環境ではmmapを使用します。
+     * @since v0.2.0-alpha
+     */
+    class MappedFile {
+    public:
+        /**
+         * @brief path_のファイルをマップします。
+         * @details ファイルを開けなかった場合や、通常のファイルでない場合はisOpen()がfalseになります。
+         * @param path_ マップするファイルのパス
+         * @since v0.2.0-alpha
+         */
+        explicit MappedFile(const std::filesystem::path& path_);
+
+        MappedFile(const MappedFile&) = delete;
+
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        /**
+         * @brief マップを解除します。
+         * @since v0.2.0-alpha
+         */
+        ~MappedFile();
+
+        /**
+         * @brief ファイルを開けたかどうかを返します。
+         * @return ファイルの内容を参照できる場合は`true`
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] bool isOpen() const;
+
+        /**
+         * @brief マップしたファイルの内容を取得します。
+         * @return ファイルの内容。ファイルを開けなかった場合は空文字列
+         * @since v0.2.0-alpha
+         */
+        [[nodiscard]] std::string_view getView() const;
+
+    private:
+        const char* _data = nullptr;
+        size_t _size = 0;
+        bool _is_open = false;
+    };
 }
 
 #endif //MULTI_PLATFORM_UTIL_H
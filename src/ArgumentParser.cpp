@@ -24,54 +24,275 @@ SOFTWARE.
 
 #include <net_ln3/cpp_lib/ArgumentParser.h>
 #include <net_ln3/cpp_lib/shorthand.h>
-#include <regex>
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <charconv>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <ranges>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <net_ln3/cpp_lib/ParseUtil.h>
 
 net_ln3::cpp_lib::ArgumentParser::OptionValue::OptionValue() : OptionValue(createInstance(nullptr)) {
 }
 
+net_ln3::cpp_lib::ArgumentParser::OptionValue::OptionValue(const OptionValue& other_)
+    : _container(other_._container.detach()) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue& net_ln3::cpp_lib::ArgumentParser::OptionValue::operator=(
+    const OptionValue& other_) {
+    _container = other_._container.detach();
+    return *this;
+}
+
 std::string net_ln3::cpp_lib::ArgumentParser::OptionValue::getString(const std::string& default_) const {
     if (isNull()) { return default_; }
-    if (isString()) { return _container.getTypeValue<std::string>(); }
-    if (isBoolean()) { return getBoolean() ? "true" : "false"; }
-    if (isSigned()) { return std::to_string(getSigned()); }
-    if (isLongDouble()) { return std::to_string(getLongDouble()); }
-    if (isUnsigned()) { return std::to_string(getUnsigned()); }
-    return default_;
+    std::string result;
+    appendString(result, default_);
+    return result;
 }
 
-sll net_ln3::cpp_lib::ArgumentParser::OptionValue::getSigned(const sll default_) const {
-    if (isSigned()) { return _container.getTypeValue<sll>(); }
-    return default_;
+namespace {
+    /**
+     * @brief std::to_chars()の結果の指数部から、先頭の`0`を取り除きます。
+     * @details `1e-07`のような表現を、StringValidatorが受け付ける`1e-7`に変換します。
+     * @return 変換後の終了位置
+     */
+    char* trimExponent(char* first_, char* last_) {
+        char* exponent = std::find(first_, last_, 'e');
+        if (exponent == last_) { return last_; }
+        char* digits = exponent + 1;
+        if (digits != last_ && (*digits == '+' || *digits == '-')) { digits++; }
+        char* nonzero = digits;
+        while (nonzero + 1 < last_ && *nonzero == '0') { nonzero++; }
+        return std::copy(nonzero, last_, digits);
+    }
+
+    /**
+     * @brief std::to_chars()で変換した10進数を、long doubleとして正確に読み戻せる場合のみ読み戻します。
+     * @details 仮数部とその10の累乗がどちらもlong doubleで正確に表せる場合、1回の乗算または除算の結果は
+     * 正しく丸められた値(std::from_chars()の結果)と一致します。それ以外の場合はstd::nulloptを返します。
+     */
+    std::optional<long double> readBackExactly(const char* first_, const char* last_) {
+        constexpr int digits = std::numeric_limits<long double>::digits;
+        constexpr uint64_t mantissa_limit = digits >= 64 ? UINT64_MAX : (uint64_t{1} << digits) - 1;
+        const bool negative = first_ != last_ && *first_ == '-';
+        if (negative) { first_++; }
+        uint64_t mantissa = 0;
+        int exponent = 0;
+        bool fraction = false;
+        for (; first_ != last_ && *first_ != 'e'; first_++) {
+            if (*first_ == '.') {
+                fraction = true;
+                continue;
+            }
+            // inf, nanは読み戻さない。
+            if (*first_ < '0' || *first_ > '9' || mantissa > (mantissa_limit - 9) / 10) { return std::nullopt; }
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*first_ - '0');
+            if (fraction) { exponent--; }
+        }
+        if (first_ != last_) {
+            int written = 0;
+            if (std::from_chars(first_ + (first_[1] == '+' ? 2 : 1), last_, written).ec != std::errc()) {
+                return std::nullopt;
+            }
+            exponent += written;
+        }
+        // 10の累乗は、5の累乗が仮数部に収まる範囲でのみ正確に表せる。
+        uint64_t power_of_five = 1;
+        long double power = 1.0l;
+        for (int i = 0; i < (exponent < 0 ? -exponent : exponent); i++) {
+            if (power_of_five > mantissa_limit / 5) { return std::nullopt; }
+            power_of_five *= 5;
+            power *= 10.0l;
+        }
+        long double value = static_cast<long double>(mantissa);
+        value = exponent < 0 ? value / power : value * power;
+        return negative ? -value : value;
+    }
+
+    /**
+     * @brief long doubleを、元の値に戻せる最短の表現に変換します。
+     * @details long doubleの最短表現への変換は遅いため、doubleに丸めた値の最短表現で元の値に戻せる場合はそれを使用します。
+     * `0.1`のように短い10進数からパースした値は、ほとんどの場合この方法で変換できます。
+     * @return 変換後の終了位置
+     */
+    char* formatLongDouble(char* first_, char* last_, const long double value_) {
+        if (char* end = std::to_chars(first_, last_, static_cast<double>(value_)).ptr;
+            readBackExactly(first_, end) == value_) { return trimExponent(first_, end); }
+        return trimExponent(first_, std::to_chars(first_, last_, value_).ptr);
+    }
+
+    /**
+     * @brief 配列の要素を、StringValidatorで読み戻せるカンマ区切りの文字列としてbuffer_に追加します。
+     */
+    template <class T>
+    void appendJoined(std::string& buffer_, const std::span<const T> values_) {
+        char chars[64];
+        for (size_t i = 0; i < values_.size(); i++) {
+            if (i != 0) { buffer_.push_back(','); }
+            char* last;
+            if constexpr (std::is_floating_point_v<T>) {
+                last = formatLongDouble(chars, chars + sizeof(chars), values_[i]);
+            }
+            else { last = std::to_chars(chars, chars + sizeof(chars), values_[i]).ptr; }
+            buffer_.append(chars, last);
+        }
+    }
 }
 
-ull net_ln3::cpp_lib::ArgumentParser::OptionValue::getUnsigned(const ull default_) const {
-    if (isUnsigned()) return _container.getTypeValue<ull>();
-    return default_;
+void net_ln3::cpp_lib::ArgumentParser::OptionValue::appendString(std::string& buffer_,
+                                                                 const std::string_view default_) const {
+    // long doubleの最短表現(符号・仮数部・指数部)が収まる大きさ
+    char chars[64];
+    char* last = chars;
+    switch (_container.getValueType()) {
+    case VContainer::Type::STRING:
+    case VContainer::Type::STRING_VIEW:
+    case VContainer::Type::RESULT_STRING:
+        buffer_.append(getStringView());
+        return;
+    case VContainer::Type::BOOLEAN:
+        buffer_.append(getBoolean() ? "true" : "false");
+        return;
+    case VContainer::Type::SIGNED:
+        last = std::to_chars(chars, chars + sizeof(chars), getSigned()).ptr;
+        break;
+    case VContainer::Type::UNSIGNED:
+        last = std::to_chars(chars, chars + sizeof(chars), getUnsigned()).ptr;
+        break;
+    case VContainer::Type::LONG_DOUBLE:
+        last = formatLongDouble(chars, chars + sizeof(chars), getLongDouble());
+        break;
+    case VContainer::Type::SIGNED_ARRAY:
+        appendJoined(buffer_, getSignedArray());
+        return;
+    case VContainer::Type::UNSIGNED_ARRAY:
+        appendJoined(buffer_, getUnsignedArray());
+        return;
+    case VContainer::Type::LONG_DOUBLE_ARRAY:
+        appendJoined(buffer_, getLongDoubleArray());
+        return;
+    default:
+        buffer_.append(default_);
+        return;
+    }
+    buffer_.append(chars, last);
 }
 
-long double net_ln3::cpp_lib::ArgumentParser::OptionValue::getLongDouble(const long double default_) const {
-    if (isLongDouble()) return _container.getTypeValue<long double>();
-    return default_;
+std::string_view net_ln3::cpp_lib::ArgumentParser::OptionValue::getStringView(
+    const std::string_view default_) const noexcept {
+    return isString() ? _container.getStringView() : default_;
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::getBoolean(const bool default_) const {
-    if (isBoolean()) return _container.getTypeValue<bool>();
-    return default_;
+sll net_ln3::cpp_lib::ArgumentParser::OptionValue::getSigned(const sll default_) const noexcept {
+    return isSigned() ? _container.getSigned() : default_;
+}
+
+ull net_ln3::cpp_lib::ArgumentParser::OptionValue::getUnsigned(const ull default_) const noexcept {
+    return isUnsigned() ? _container.getUnsigned() : default_;
+}
+
+long double net_ln3::cpp_lib::ArgumentParser::OptionValue::getLongDouble(const long double default_) const noexcept {
+    return isLongDouble() ? _container.getLongDouble() : default_;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::getBoolean(const bool default_) const noexcept {
+    return isBoolean() ? _container.getBoolean() : default_;
+}
+
+std::span<const long long> net_ln3::cpp_lib::ArgumentParser::OptionValue::getSignedArray() const noexcept {
+    return isSignedArray() ? _container.getSignedArray() : std::span<long long>();
+}
+
+std::span<const unsigned long long> net_ln3::cpp_lib::ArgumentParser::OptionValue::getUnsignedArray() const noexcept {
+    return isUnsignedArray() ? _container.getUnsignedArray() : std::span<unsigned long long>();
+}
+
+std::span<const long double> net_ln3::cpp_lib::ArgumentParser::OptionValue::getLongDoubleArray() const noexcept {
+    return isLongDoubleArray() ? _container.getLongDoubleArray() : std::span<long double>();
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isNull() const noexcept {
+    return _container.getType() == VContainer::Type::NULLITY;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isString() const noexcept {
+    const auto type = _container.getType();
+    return type == VContainer::Type::STRING || type == VContainer::Type::STRING_VIEW
+        || type == VContainer::Type::RESULT_STRING;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isSigned() const noexcept {
+    return _container.getValueType() == VContainer::Type::SIGNED;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isUnsigned() const noexcept {
+    return _container.getValueType() == VContainer::Type::UNSIGNED;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isLongDouble() const noexcept {
+    return _container.getValueType() == VContainer::Type::LONG_DOUBLE;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isBoolean() const noexcept {
+    return _container.getType() == VContainer::Type::BOOLEAN;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isSignedArray() const noexcept {
+    return _container.getType() == VContainer::Type::SIGNED_ARRAY;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isUnsignedArray() const noexcept {
+    return _container.getType() == VContainer::Type::UNSIGNED_ARRAY;
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isNull() const { return _container.checkType<std::nullptr_t>(); }
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isLongDoubleArray() const noexcept {
+    return _container.getType() == VContainer::Type::LONG_DOUBLE_ARRAY;
+}
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isString() const { return _container.checkType<std::string>(); }
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::OptionValue::tryGet(
+    sll& value_) const noexcept {
+    if (!isSigned()) { return ErrorCode::TYPE_MISMATCH; }
+    value_ = getSigned();
+    return ErrorCode::NONE;
+}
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isSigned() const { return _container.checkType<sll>(); }
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::OptionValue::tryGet(
+    ull& value_) const noexcept {
+    if (!isUnsigned()) { return ErrorCode::TYPE_MISMATCH; }
+    value_ = getUnsigned();
+    return ErrorCode::NONE;
+}
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isUnsigned() const { return _container.checkType<ull>(); }
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::OptionValue::tryGet(
+    long double& value_) const noexcept {
+    if (!isLongDouble()) { return ErrorCode::TYPE_MISMATCH; }
+    value_ = getLongDouble();
+    return ErrorCode::NONE;
+}
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isLongDouble() const { return _container.checkType<long double>(); }
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::OptionValue::tryGet(
+    bool& value_) const noexcept {
+    if (!isBoolean()) { return ErrorCode::TYPE_MISMATCH; }
+    value_ = getBoolean();
+    return ErrorCode::NONE;
+}
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionValue::isBoolean() const { return _container.checkType<bool>(); }
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::OptionValue::tryGet(
+    std::string_view& value_) const noexcept {
+    if (!isString()) { return ErrorCode::TYPE_MISMATCH; }
+    value_ = getStringView();
+    return ErrorCode::NONE;
+}
 
 net_ln3::cpp_lib::ArgumentParser::OptionValue::operator std::string() const { return getString(); }
 
@@ -83,53 +304,312 @@ net_ln3::cpp_lib::ArgumentParser::OptionValue::operator long double() const { re
 
 net_ln3::cpp_lib::ArgumentParser::OptionValue::operator bool() const { return getBoolean(); }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const std::nullptr_t v_): _value(v_) {
+struct net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_SharedBlock {
+    std::atomic<size_t> references;
+};
+
+namespace {
+    /// 参照カウントの直後に置く値の位置。long doubleの境界に揃える。
+    constexpr size_t shared_value_offset = alignof(long double) > sizeof(std::atomic<size_t>)
+                                               ? alignof(long double)
+                                               : sizeof(std::atomic<size_t>);
+
+    /// long doubleの表現が16バイトに直接収まるか。(doubleと同じ表現、またはリトルエンディアンのx87拡張精度)
+    constexpr bool inline_long_double =
+        (std::numeric_limits<long double>::digits == std::numeric_limits<double>::digits
+            && sizeof(long double) == sizeof(double))
+        || (std::numeric_limits<long double>::digits == 64 && sizeof(long double) >= 10
+            && std::endian::native == std::endian::little);
+
+    /// 直接格納する場合に、_payloadの8バイトに収まらない部分(x87の符号と指数部)の大きさ
+    constexpr size_t long_double_high_size = sizeof(long double) > sizeof(double) ? 2 : 0;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const std::nullptr_t v_) noexcept
+    : VContainer(Type::NULLITY, 0) {
+    static_cast<void>(v_);
 }
 
 net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const char* v_)
-    : VContainer(std::string(v_)) {
+    : VContainer(createOwned(v_)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const std::string& v_)
+    : VContainer(createOwned(v_)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const std::string_view v_) noexcept
+    : VContainer(Type::STRING_VIEW, v_.size()) {
+    _payload.view = v_.data();
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const long double v_)
+    : VContainer(Type::NULLITY, 0) {
+    if (!_storeLongDouble(v_)) { multi_platform::raise(std::bad_alloc()); }
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const double v_)
+    : VContainer(static_cast<long double>(v_)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const bool v_) noexcept
+    : VContainer(Type::BOOLEAN, 0) {
+    _payload.boolean = v_;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const int v_) noexcept
+    : VContainer(static_cast<sll>(v_)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const unsigned v_) noexcept
+    : VContainer(static_cast<ull>(v_)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const long long v_) noexcept
+    : VContainer(Type::SIGNED, 0) {
+    _payload.signed_integer = v_;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const unsigned long long v_) noexcept
+    : VContainer(Type::UNSIGNED, 0) {
+    _payload.unsigned_integer = v_;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const VContainer& other_) noexcept
+    : _payload(other_._payload), _meta(other_._meta) {
+    _retain();
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(VContainer&& other_) noexcept
+    : _payload(other_._payload), _meta(other_._meta) {
+    other_._meta = static_cast<uint64_t>(Type::NULLITY);
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer&
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::operator=(const VContainer& other_) noexcept {
+    // 自己代入でも解放されないよう、先に参照カウントを増やす。
+    other_._retain();
+    _release();
+    _payload = other_._payload;
+    _meta = other_._meta;
+    return *this;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer&
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::operator=(VContainer&& other_) noexcept {
+    if (this != &other_) {
+        _release();
+        _payload = other_._payload;
+        _meta = other_._meta;
+        other_._meta = static_cast<uint64_t>(Type::NULLITY);
+    }
+    return *this;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::~VContainer() { _release(); }
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::createOwned(const std::string_view v_) {
+    VContainer container(Type::STRING, v_.size());
+    const auto memory = static_cast<std::byte*>(::operator new(sizeof(_SharedBlock) + v_.size()));
+    container._payload.block = ::new(memory) _SharedBlock{1};
+    std::ranges::copy(v_, reinterpret_cast<char*>(memory + sizeof(_SharedBlock)));
+    return container;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::createResultString(const std::string_view v_) noexcept {
+    VContainer container(Type::RESULT_STRING, v_.size());
+    container._payload.view = v_.data();
+    return container;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::createLazy(const Type type_,
+                                                                      const std::string_view raw_) noexcept {
+    const Type lazy_type = type_ == Type::SIGNED
+                               ? Type::LAZY_SIGNED
+                               : type_ == Type::UNSIGNED
+                               ? Type::LAZY_UNSIGNED
+                               : Type::LAZY_LONG_DOUBLE;
+    VContainer container(lazy_type, raw_.size());
+    container._payload.view = raw_.data();
+    return container;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::createArray(const Type type_, const size_t count_) {
+    const size_t element_size = type_ == Type::LONG_DOUBLE_ARRAY ? sizeof(long double) : sizeof(uint64_t);
+    VContainer container(type_, count_);
+    const auto memory = static_cast<std::byte*>(::operator new(shared_value_offset + element_size * count_,
+                                                               std::align_val_t(alignof(long double))));
+    container._payload.block = ::new(memory) _SharedBlock{1};
+    if (type_ == Type::SIGNED_ARRAY) { std::uninitialized_value_construct_n(container.getSignedArray().data(), count_); }
+    else if (type_ == Type::UNSIGNED_ARRAY) {
+        std::uninitialized_value_construct_n(container.getUnsignedArray().data(), count_);
+    }
+    else { std::uninitialized_value_construct_n(container.getLongDoubleArray().data(), count_); }
+    return container;
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::Type
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getValueType() const noexcept {
+    switch (getType()) {
+    case Type::LAZY_SIGNED:
+        return Type::SIGNED;
+    case Type::LAZY_UNSIGNED:
+        return Type::UNSIGNED;
+    case Type::LAZY_LONG_DOUBLE:
+        return Type::LONG_DOUBLE;
+    default:
+        return getType();
+    }
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::detach() const {
+    switch (getType()) {
+    case Type::LAZY_SIGNED:
+        return VContainer(getSigned());
+    case Type::LAZY_UNSIGNED:
+        return VContainer(getUnsigned());
+    case Type::LAZY_LONG_DOUBLE:
+        return VContainer(getLongDouble());
+    case Type::RESULT_STRING:
+        return createOwned(getStringView());
+    default:
+        return *this;
+    }
+}
+
+long long net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getSigned() const noexcept {
+    // パース時に検証済みのため、変換は失敗しない。
+    if (getType() == Type::LAZY_SIGNED) { return ParseUtil::StringValidator::parseSigned(_lazyView()).value_or(0); }
+    return _payload.signed_integer;
+}
+
+unsigned long long net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getUnsigned() const noexcept {
+    if (getType() == Type::LAZY_UNSIGNED) {
+        return ParseUtil::StringValidator::parseUnsigned(_lazyView()).value_or(0);
+    }
+    return _payload.unsigned_integer;
+}
+
+long double net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getLongDouble() const noexcept {
+    if (getType() == Type::LAZY_LONG_DOUBLE) {
+        return ParseUtil::StringValidator::parseLongDouble(_lazyView()).value_or(0.0l);
+    }
+    if constexpr (inline_long_double) {
+        unsigned char bytes[sizeof(long double)]{};
+        std::memcpy(bytes, &_payload.unsigned_integer, sizeof(double));
+        if constexpr (long_double_high_size != 0) {
+            const auto high = static_cast<uint16_t>(_meta >> _SIZE_SHIFT);
+            std::memcpy(bytes + sizeof(double), &high, long_double_high_size);
+        }
+        long double value;
+        std::memcpy(&value, bytes, sizeof(long double));
+        return value;
+    }
+    else { return *std::launder(reinterpret_cast<const long double*>(_sharedValue())); }
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getStringView() const noexcept {
+    const size_t size = _meta >> _SIZE_SHIFT;
+    if (getType() == Type::STRING_VIEW || getType() == Type::RESULT_STRING) { return {_payload.view, size}; }
+    return {reinterpret_cast<const char*>(_payload.block) + sizeof(_SharedBlock), size};
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(std::string v_): _value(std::move(v_)) {
+std::span<long long> net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getSignedArray() const noexcept {
+    return {std::launder(reinterpret_cast<long long*>(_sharedValue())), _meta >> _SIZE_SHIFT};
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const long double v_): _value(v_) {
+std::span<unsigned long long>
+net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getUnsignedArray() const noexcept {
+    return {std::launder(reinterpret_cast<unsigned long long*>(_sharedValue())), _meta >> _SIZE_SHIFT};
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const double v_): _value(
-    static_cast<long double>(v_)) {
+std::span<long double> net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::getLongDoubleArray() const noexcept {
+    return {std::launder(reinterpret_cast<long double*>(_sharedValue())), _meta >> _SIZE_SHIFT};
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const bool v_): _value(v_) {
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_storeLongDouble(const long double v_) noexcept {
+    if constexpr (inline_long_double) {
+        // 下位8バイト(仮数部)を_payloadに、x87の場合は続く2バイト(符号と指数部)を_metaの上位ビットに格納する。
+        unsigned char bytes[sizeof(long double)];
+        std::memcpy(bytes, &v_, sizeof(long double));
+        uint16_t high = 0;
+        if constexpr (long_double_high_size != 0) {
+            std::memcpy(&high, bytes + sizeof(double), long_double_high_size);
+        }
+        std::memcpy(&_payload.unsigned_integer, bytes, sizeof(double));
+        _meta = static_cast<uint64_t>(Type::LONG_DOUBLE) | static_cast<uint64_t>(high) << _SIZE_SHIFT;
+        return true;
+    }
+    // それ以外の環境では8バイトに収まらないため、参照カウント付きの領域に格納する。
+    const auto memory = static_cast<std::byte*>(::operator new(shared_value_offset + sizeof(long double),
+                                                               std::align_val_t(alignof(long double)),
+                                                               std::nothrow));
+    if (memory == nullptr) { return false; }
+    _payload.block = ::new(memory) _SharedBlock{1};
+    ::new(memory + shared_value_offset) long double(v_);
+    _meta = static_cast<uint64_t>(Type::LONG_DOUBLE);
+    return true;
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const int v_)
-    : _value(static_cast<sll>(v_)) {
+std::string_view net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_lazyView() const noexcept {
+    return {_payload.view, _meta >> _SIZE_SHIFT};
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_isShared() const noexcept {
+    switch (getType()) {
+    case Type::STRING:
+    case Type::SIGNED_ARRAY:
+    case Type::UNSIGNED_ARRAY:
+    case Type::LONG_DOUBLE_ARRAY:
+        return true;
+    case Type::LONG_DOUBLE:
+        return !inline_long_double;
+    default:
+        return false;
+    }
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const unsigned v_)
-    : _value(static_cast<ull>(v_)) {
+std::byte* net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_sharedValue() const noexcept {
+    return reinterpret_cast<std::byte*>(_payload.block) + shared_value_offset;
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const long long v_): _value(v_) {
+void net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_retain() const noexcept {
+    if (_isShared()) { _payload.block->references.fetch_add(1, std::memory_order_relaxed); }
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::VContainer(const unsigned long long v_): _value(v_) {
+void net_ln3::cpp_lib::ArgumentParser::OptionValue::VContainer::_release() noexcept {
+    if (!_isShared()) { return; }
+    if (_payload.block->references.fetch_sub(1, std::memory_order_acq_rel) != 1) { return; }
+    // 要素はいずれもトリビアルに破棄できるため、領域のみを解放する。
+    _payload.block->~_SharedBlock();
+    if (getType() == Type::STRING) { ::operator delete(_payload.block); }
+    else { ::operator delete(_payload.block, std::align_val_t(alignof(long double))); }
+    _meta = static_cast<uint64_t>(Type::NULLITY);
 }
 
 net_ln3::cpp_lib::ArgumentParser::OptionNames::OptionNames(
-    std::unordered_map<std::string, OptionType> table_) : _name_type_table(std::move(table_)) {
+    std::unordered_map<std::string, OptionType> table_) : _name_type_table(
+    std::make_move_iterator(table_.begin()), std::make_move_iterator(table_.end())) {
 }
 
 net_ln3::cpp_lib::ArgumentParser::OptionType net_ln3::cpp_lib::ArgumentParser::OptionNames::getOptionType(
-    const std::string& option_name_) const {
-    if (_name_type_table.contains(option_name_)) {
-        if (const auto t = _name_type_table.at(option_name_); t != OptionType::NULLITY) { return t; }
-    }
+    const std::string_view option_name_) const {
+    if (const auto t = findOptionType(option_name_); t != nullptr && *t != OptionType::NULLITY) { return *t; }
     return OptionType();
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionNames::isExistOption(const std::string& option_name_) const {
+const net_ln3::cpp_lib::ArgumentParser::OptionType* net_ln3::cpp_lib::ArgumentParser::OptionNames::findOptionType(
+    const std::string_view option_name_) const {
+    const auto found = _name_type_table.find(option_name_);
+    return found != _name_type_table.end() ? &found->second : nullptr;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionNames::isExistOption(const std::string_view option_name_) const {
     return _name_type_table.contains(option_name_);
 }
 
@@ -149,15 +629,22 @@ bool net_ln3::cpp_lib::ArgumentParser::OptionNames::removeOption(const std::stri
 }
 
 net_ln3::cpp_lib::ArgumentParser::OptionAlias::OptionAlias(
-    std::unordered_map<std::string, std::string> table_) : _name_alias_table(std::move(table_)) {
+    std::unordered_map<std::string, std::string> table_) : _name_alias_table(
+    std::make_move_iterator(table_.begin()), std::make_move_iterator(table_.end())) {
 }
 
-std::string net_ln3::cpp_lib::ArgumentParser::OptionAlias::getOptionName(const std::string& alias_name_) const {
-    if (_name_alias_table.contains(alias_name_)) { return _name_alias_table.at(alias_name_); }
+std::string net_ln3::cpp_lib::ArgumentParser::OptionAlias::getOptionName(const std::string_view alias_name_) const {
+    if (const auto name = findOptionName(alias_name_); name != nullptr) { return *name; }
     return "";
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::OptionAlias::isExistAlias(const std::string& alias_name_) const {
+const std::string* net_ln3::cpp_lib::ArgumentParser::OptionAlias::findOptionName(
+    const std::string_view alias_name_) const {
+    const auto found = _name_alias_table.find(alias_name_);
+    return found != _name_alias_table.end() ? &found->second : nullptr;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::OptionAlias::isExistAlias(const std::string_view alias_name_) const {
     return _name_alias_table.contains(alias_name_);
 }
 
@@ -176,212 +663,1601 @@ bool net_ln3::cpp_lib::ArgumentParser::OptionAlias::removeAlias(const std::strin
     return false;
 }
 
-net_ln3::cpp_lib::ArgumentParser::ArgumentParser() : _option_mapper_mode(false) {
+const net_ln3::cpp_lib::ArgumentParser::OptionSpec* net_ln3::cpp_lib::ArgumentParser::StaticOptionTable::findOption(
+    const std::string_view option_name_) const noexcept {
+    const uint64_t h = hash(option_name_, _seed);
+    const uint32_t d = _option_displacements[h & (_option_displacements.size() - 1)];
+    const uint32_t index = _option_slots[slotOf(h, d, _option_slots.size())];
+    if (index == EMPTY_SLOT || _specs[index].name != option_name_) { return nullptr; }
+    return &_specs[index];
 }
 
-net_ln3::cpp_lib::ArgumentParser::ArgumentParser(OptionNames type_) : ArgumentParser(std::move(type_), {}) {
+const net_ln3::cpp_lib::ArgumentParser::OptionSpec* net_ln3::cpp_lib::ArgumentParser::StaticOptionTable::findAlias(
+    const std::string_view alias_name_) const noexcept {
+    const uint64_t h = hash(alias_name_, _seed);
+    const uint32_t d = _alias_displacements[h & (_alias_displacements.size() - 1)];
+    const uint32_t index = _alias_slots[slotOf(h, d, _alias_slots.size())];
+    if (index == EMPTY_SLOT) { return nullptr; }
+    const auto& aliases = _specs[index].aliases;
+    if (std::find(aliases.begin(), aliases.end(), alias_name_) == aliases.end()) { return nullptr; }
+    return &_specs[index];
 }
 
-net_ln3::cpp_lib::ArgumentParser::ArgumentParser(OptionNames type_,
-                                                 OptionAlias
-                                                 alias_) : _valid_option_names(std::move(type_)),
-                                                           _valid_alias(std::move(alias_)),
-                                                           _option_mapper_mode(true) {
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::FrozenOptionTable(const OptionNames& names_,
+                                                                       const OptionAlias& alias_) {
+    const size_t key_count = names_._name_type_table.size() + alias_._name_alias_table.size();
+    // 負荷率を0.5以下に抑え、ほとんどの検索が1回の探索で終わるようにする。
+    _slots.resize(std::bit_ceil(key_count * 2 + 1));
+    _option_count = names_._name_type_table.size();
+    _options.reserve(_option_count);
+    std::unordered_map<std::string_view, uint32_t> option_indices;
+    for (const auto& [name, type] : names_._name_type_table) {
+        const auto index = static_cast<uint32_t>(_options.size());
+        _options.push_back({_appendName(name), static_cast<uint32_t>(name.size()), type});
+        option_indices.try_emplace(name, index);
+        _insert(name, index);
+    }
+    for (const auto& [alias, name] : alias_._name_alias_table) {
+        const auto found = option_indices.find(name);
+        const uint32_t index = found != option_indices.end() ? found->second : _UNKNOWN_OPTION;
+        if (index == _UNKNOWN_OPTION) {
+            // 紐づけ先の名称は、登録されていないオプションとして保持する。
+            _options.push_back({_appendName(name), static_cast<uint32_t>(name.size()), OptionType::NULLITY});
+            _insert(alias, static_cast<uint32_t>(_options.size() - 1) | _ALIAS_BIT);
+            continue;
+        }
+        _insert(alias, index | _ALIAS_BIT);
+    }
+    // 接頭辞による検索のため、名称の昇順に並べた索引を作成する。
+    _option_index.reserve(_option_count);
+    _alias_index.reserve(key_count - _option_count);
+    for (uint32_t i = 0; i < _slots.size(); i++) {
+        if (_slots[i].target == _EMPTY_SLOT) { continue; }
+        ((_slots[i].target & _ALIAS_BIT) != 0 ? _alias_index : _option_index).push_back(i);
+    }
+    const auto by_key = [this](const uint32_t lhs_, const uint32_t rhs_) { return _keyOf(lhs_) < _keyOf(rhs_); };
+    std::ranges::sort(_option_index, by_key);
+    std::ranges::sort(_alias_index, by_key);
 }
 
-void net_ln3::cpp_lib::ArgumentParser::parse(const int argc_, char** argv_) {
-    const std::vector<std::string> args(argv_, argv_ + argc_);
-    this->parse(args);
+std::optional<net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::Entry>
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::findOption(const std::string_view option_name_) const noexcept {
+    const auto slot = _find(option_name_, false);
+    if (slot == nullptr) { return std::nullopt; }
+    return _toEntry(slot->target);
 }
 
-void net_ln3::cpp_lib::ArgumentParser::parse(const std::vector<std::string>& args_) {
-    // 次のコマンドライン引数がオプションの値である
-    bool option_value_flag = false;
-    std::string option_name;
-    std::string alias_name;
-    for (auto& arg : args_) {
-        // オプションを登録する。
-        if (option_value_flag) {
-            // マッピングモードでない場合。(従来の動作)
-            if (!_option_mapper_mode) {
-                if (option_name.empty()) { _addInvalidAlias(alias_name, arg); }
-                else { _addOption(option_name, OptionValue::createInstance(arg)); }
-                // エイリアス名が存在しない場合
-            }
-            else if (option_name.empty()) {
-                _addInvalidAlias(alias_name, arg);
-                // オプション名が存在する場合
-            }
-            else if (_valid_option_names.isExistOption(option_name)) {
-                if (const auto t = _valid_option_names.getOptionType(option_name); _isValidType(arg, t)) {
-                    _addOption(option_name, _convertOptionValue(arg, t));
-                }
-                else {
-                    // 型検証に失敗したオプションを登録する。
-                    _addInvalidOptionType(option_name, arg, t);
-                }
-                // オプション名が存在しない場合
-            }
-            else { _addInvalidOption(option_name, arg); }
-            option_name = "";
-            alias_name = "";
-            option_value_flag = false;
-            // オプション名を取得する。
-        }
-        else {
-            if (_isOptionName(arg)) { option_name = _getOptionName(arg); }
-            else if (_isAliasName(arg)) { alias_name = _getAliasName(arg); }
-            else {
-                _addArgument(arg);
-                continue;
-            }
-            // エイリアス名でオプションが指定されている場合、それをオプション名に変換する。
-            if (!alias_name.empty()) { option_name = _valid_alias.getOptionName(alias_name); }
-            // オプションが真偽型の場合、フラグとして扱う。
-            if (_valid_option_names.getOptionType(option_name) == OptionType::BOOLEAN) {
-                _addOption(option_name, OptionValue::createInstance(true));
-                option_name = "";
-                alias_name = "";
-            }
-            else {
-                // オプション<フラグ>以外では次の入力をオプションの値とする
-                option_value_flag = true;
-            }
-        }
+std::optional<net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::Entry>
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::findAlias(const std::string_view alias_name_) const noexcept {
+    const auto slot = _find(alias_name_, true);
+    if (slot == nullptr) { return std::nullopt; }
+    return _toEntry(slot->target & ~_ALIAS_BIT);
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::Entry>
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::resolveOptionPrefix(const std::string_view prefix_,
+                                                                         bool& ambiguous_) const noexcept {
+    ambiguous_ = false;
+    if (const auto exact = findOption(prefix_); exact.has_value()) { return exact; }
+    const auto range = _prefixRange(_option_index, prefix_);
+    ambiguous_ = range.size() > 1;
+    if (range.size() != 1) { return std::nullopt; }
+    return _toEntry(_slots[range.front()].target);
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::Entry>
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::resolveAliasPrefix(const std::string_view prefix_,
+                                                                        bool& ambiguous_) const noexcept {
+    ambiguous_ = false;
+    if (const auto exact = findAlias(prefix_); exact.has_value()) { return exact; }
+    const auto range = _prefixRange(_alias_index, prefix_);
+    ambiguous_ = range.size() > 1;
+    if (range.size() != 1) { return std::nullopt; }
+    return _toEntry(_slots[range.front()].target & ~_ALIAS_BIT);
+}
+
+size_t net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::completeOption(
+    const std::string_view prefix_, std::vector<std::string_view>& completions_) const {
+    const auto range = _prefixRange(_option_index, prefix_);
+    for (const auto slot : range) { completions_.push_back(_keyOf(slot)); }
+    return range.size();
+}
+
+size_t net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::completeAlias(
+    const std::string_view prefix_, std::vector<std::string_view>& completions_) const {
+    const auto range = _prefixRange(_alias_index, prefix_);
+    for (const auto slot : range) { completions_.push_back(_keyOf(slot)); }
+    return range.size();
+}
+
+size_t net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::size() const noexcept { return _option_count; }
+
+uint32_t net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_appendName(const std::string_view name_) {
+    const auto offset = static_cast<uint32_t>(_names.size());
+    _names.append(name_);
+    return offset;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_insert(const std::string_view key_,
+                                                                  const uint32_t target_) {
+    const bool alias = (target_ & _ALIAS_BIT) != 0;
+    const uint64_t h = StaticOptionTable::hash(key_, alias ? 1 : 0);
+    const size_t mask = _slots.size() - 1;
+    size_t i = h & mask;
+    while (_slots[i].target != _EMPTY_SLOT) { i = (i + 1) & mask; }
+    _slots[i] = {static_cast<uint32_t>(h >> 32), _appendName(key_), static_cast<uint32_t>(key_.size()), target_};
+}
+
+const net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_Slot*
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_find(const std::string_view key_,
+                                                           const bool alias_) const noexcept {
+    if (_slots.empty()) { return nullptr; }
+    const uint64_t h = StaticOptionTable::hash(key_, alias_ ? 1 : 0);
+    const auto tag = static_cast<uint32_t>(h >> 32);
+    const size_t mask = _slots.size() - 1;
+    for (size_t i = h & mask; _slots[i].target != _EMPTY_SLOT; i = (i + 1) & mask) {
+        const auto& slot = _slots[i];
+        if (slot.tag == tag && ((slot.target & _ALIAS_BIT) != 0) == alias_ && slot.key_length == key_.size() &&
+            std::string_view(_names).substr(slot.key_offset, slot.key_length) == key_) { return &slot; }
+    }
+    return nullptr;
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_keyOf(const uint32_t slot_index_) const noexcept {
+    return std::string_view(_names).substr(_slots[slot_index_].key_offset, _slots[slot_index_].key_length);
+}
+
+std::span<const uint32_t> net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_prefixRange(
+    const std::vector<uint32_t>& index_, const std::string_view prefix_) const noexcept {
+    // 名称を接頭辞の長さに切り詰めると、索引の順序を保ったまま、一致する範囲が連続した等しい値になる。
+    return std::ranges::equal_range(index_, prefix_, {}, [this, &prefix_](const uint32_t slot_) {
+        return _keyOf(slot_).substr(0, prefix_.size());
+    });
+}
+
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::Entry
+net_ln3::cpp_lib::ArgumentParser::FrozenOptionTable::_toEntry(const uint32_t option_index_) const noexcept {
+    const auto& option = _options[option_index_];
+    return {
+        std::string_view(_names).substr(option.name_offset, option.name_length), option.type,
+        option_index_ < _option_count
+    };
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_StringArena::_StringArena(std::pmr::memory_resource* upstream_)
+    : _upstream(upstream_), _blocks(upstream_) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_StringArena::~_StringArena() {
+    for (const auto& [data, size] : _blocks) { _upstream->deallocate(data, size, alignof(char)); }
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::ParseResult::_StringArena::copy(const std::string_view str_) {
+    // 現在のブロックに収まらない場合は、次のブロックへ進む。確保済みのブロックが無い場合は新たに確保する。
+    while (_block_index < _blocks.size() && _blocks[_block_index].size - _used < str_.size()) {
+        _block_index++;
+        _used = 0;
     }
+    if (_block_index == _blocks.size()) {
+        const size_t size = std::max({_MIN_BLOCK_SIZE, str_.size(), _blocks.empty() ? 0 : _blocks.back().size * 2});
+        _blocks.push_back({static_cast<char*>(_upstream->allocate(size, alignof(char))), size});
+    }
+    const auto buffer = _blocks[_block_index].data + _used;
+    std::ranges::copy(str_, buffer);
+    _used += str_.size();
+    return {buffer, str_.size()};
+}
+
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_StringArena::rewind() noexcept {
+    _block_index = 0;
+    _used = 0;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::ParseResult(std::pmr::memory_resource* resource_)
+    : _memory_resource(resource_),
+      _string_arenas(_getMemoryResource()),
+      _arg_views(_getMemoryResource()),
+      _mapped_files(_getMemoryResource()),
+      _options(_getMemoryResource()),
+      _option_lists(_getMemoryResource()),
+      _diagnostics(_getMemoryResource()),
+      _fallback_options(_getMemoryResource()) {
+}
+
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::reset() {
+    _arg_views.clear();
+    _args.clear();
+    _mapped_files.clear();
+    _options.clear();
+    for (auto& list : _option_lists | std::views::values) { list.clear(); }
+    _pending.option_value_flag = false;
+    _diagnostics.clear();
+    _grouped_diagnostics.table.invalid_options.clear();
+    _grouped_diagnostics.table.invalid_option_types.clear();
+    _grouped_diagnostics.table.invalid_alias.clear();
+    _grouped_diagnostics.table.count = 0;
+    _token_count = 0;
+    _command = {};
+    _fallback_applied = false;
+    _applying_fallback = false;
+    _fallback_options.clear();
+    // コピーしたインスタンスと共有している文字列領域は、そのインスタンスが参照しているため再利用しない。
+    std::erase_if(_string_arenas, [](const auto& arena_) { return arena_.use_count() > 1; });
+    for (const auto& arena : _string_arenas) { arena->rewind(); }
+}
+
+const std::vector<std::string>& net_ln3::cpp_lib::ArgumentParser::ParseResult::getArgs() const {
+    return _args;
 }
 
-const std::vector<std::string>& net_ln3::cpp_lib::ArgumentParser::getArgs() const { return _args; }
+std::span<const std::string_view> net_ln3::cpp_lib::ArgumentParser::ParseResult::getArgViews() const {
+    return _arg_views;
+}
 
-std::string net_ln3::cpp_lib::ArgumentParser::getArg(const size_t i_) const {
-    if (i_ < _args.size()) { return _args.at(i_); }
+std::string net_ln3::cpp_lib::ArgumentParser::ParseResult::getArg(const size_t i_) const {
+    if (i_ < _arg_views.size()) { return std::string(_arg_views.at(i_)); }
     return "";
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::getOption(
-    const std::string& option_name_, const OptionValue& default_) const {
-    if (_options.contains(option_name_)) { return _options.at(option_name_); }
+net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::ParseResult::getOption(
+    const std::string_view option_name_, const OptionValue& default_) const {
+    if (const auto value = findOption(option_name_); value != nullptr) { return *value; }
     return default_;
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::isExistOption(const std::string& key_) const { return _options.contains(key_); }
+const net_ln3::cpp_lib::ArgumentParser::OptionValue* net_ln3::cpp_lib::ArgumentParser::ParseResult::findOption(
+    const std::string_view option_name_) const noexcept {
+    const auto found = _options.find(option_name_);
+    return found != _options.end() ? &found->second : nullptr;
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::ParseResult::isExistOption(const std::string_view key_) const {
+    return _options.contains(key_);
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::ParseResult::hasErrors() const noexcept {
+    return !_diagnostics.empty();
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::ParseResult::getCommand() const noexcept { return _command; }
+
+std::span<const std::string_view> net_ln3::cpp_lib::ArgumentParser::ParseResult::getStringList(
+    const std::string_view option_name_) const noexcept {
+    const auto found = _option_lists.find(option_name_);
+    return found != _option_lists.end()
+               ? std::span<const std::string_view>(found->second.strings)
+               : std::span<const std::string_view>();
+}
+
+std::span<const long long> net_ln3::cpp_lib::ArgumentParser::ParseResult::getSignedList(
+    const std::string_view option_name_) const noexcept {
+    const auto found = _option_lists.find(option_name_);
+    return found != _option_lists.end() ? std::span<const sll>(found->second.signed_values) : std::span<const sll>();
+}
+
+std::span<const unsigned long long> net_ln3::cpp_lib::ArgumentParser::ParseResult::getUnsignedList(
+    const std::string_view option_name_) const noexcept {
+    const auto found = _option_lists.find(option_name_);
+    return found != _option_lists.end() ? std::span<const ull>(found->second.unsigned_values) : std::span<const ull>();
+}
+
+std::span<const long double> net_ln3::cpp_lib::ArgumentParser::ParseResult::getLongDoubleList(
+    const std::string_view option_name_) const noexcept {
+    const auto found = _option_lists.find(option_name_);
+    return found != _option_lists.end()
+               ? std::span<const long double>(found->second.long_double_values)
+               : std::span<const long double>();
+}
+
+std::span<const net_ln3::cpp_lib::ArgumentParser::ParseResult::Diagnostic>
+net_ln3::cpp_lib::ArgumentParser::ParseResult::getDiagnostics() const noexcept { return _diagnostics; }
 
 const std::unordered_map<std::string, std::vector<std::string>>&
-net_ln3::cpp_lib::ArgumentParser::getInvalidOptions() const { return _invalid_options; }
+net_ln3::cpp_lib::ArgumentParser::ParseResult::getInvalidOptions() const {
+    return _getGroupedDiagnostics().invalid_options;
+}
 
 const std::unordered_map<std::string, std::vector<std::pair<std::string,
                                                             net_ln3::cpp_lib::ArgumentParser::OptionType>>>&
-net_ln3::cpp_lib::ArgumentParser::getInvalidOptionTypes() const { return _invalid_option_types; }
+net_ln3::cpp_lib::ArgumentParser::ParseResult::getInvalidOptionTypes() const {
+    return _getGroupedDiagnostics().invalid_option_types;
+}
 
 const std::unordered_map<std::string, std::vector<std::string>>&
-net_ln3::cpp_lib::ArgumentParser::getInvalidAlias() const { return _invalid_alias; }
-
-std::string net_ln3::cpp_lib::ArgumentParser::_getOptionName(const std::string& option_arg_) {
-    return std::regex_replace(option_arg_, _extract_option_name_pattern, "");
+net_ln3::cpp_lib::ArgumentParser::ParseResult::getInvalidAlias() const {
+    return _getGroupedDiagnostics().invalid_alias;
 }
 
-std::string net_ln3::cpp_lib::ArgumentParser::_getAliasName(const std::string& alias_arg_) {
-    return std::regex_replace(alias_arg_, _extract_alias_name_pattern, "");
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_addOption(const std::string_view option_name_,
+                                                               OptionValue value_,
+                                                               const _StringStorage name_storage_) {
+    if (const auto found = _options.find(option_name_); found != _options.end()) {
+        if (_takeFallbackOption(option_name_)) {
+            found->second = std::move(value_);
+            return;
+        }
+        // 文字列に変換した値は一時的なため、文字列領域にコピーする。
+        _addDiagnostic(Diagnostic::Kind::INVALID_OPTION, option_name_, value_.getString(), OptionType::NULLITY,
+                       _StringStorage::COPY, name_storage_);
+        return;
+    }
+    // 結果が保持する名称(設定ファイルのキー)以外は、呼び出し元の文字列より長く検索できるよう文字列領域にコピーする。
+    _options.try_emplace(name_storage_ == _StringStorage::RESULT ? option_name_ : _copyString(option_name_),
+                         std::move(value_));
+    _recordFallbackOption(option_name_);
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::_isOptionName(const std::string& option_arg_) {
-    return std::regex_match(option_arg_, _option_name_pattern);
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_addArgument(const std::string_view value_,
+                                                                 const _StringStorage storage_) {
+    _arg_views.push_back(storage_ == _StringStorage::COPY ? _copyString(value_) : value_);
+    // const関数から変更せずに返せるよう、所有する文字列のリストは追加時に作成する。
+    _args.emplace_back(value_);
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::_isAliasName(const std::string& alias_arg_) {
-    return std::regex_match(alias_arg_, _alias_name_pattern);
+std::pmr::memory_resource* net_ln3::cpp_lib::ArgumentParser::ParseResult::_getMemoryResource() const {
+    return _memory_resource != nullptr ? _memory_resource : std::pmr::get_default_resource();
 }
 
-void net_ln3::cpp_lib::ArgumentParser::_addOption(const std::string& option_name_, OptionValue value_) {
-    if (_options.contains(option_name_)) {
-        _addInvalidOption(option_name_, value_.getString());
-        return;
+std::string_view net_ln3::cpp_lib::ArgumentParser::ParseResult::_copyString(const std::string_view str_) {
+    if (str_.empty()) { return {}; }
+    // 他のインスタンスと共有している領域は、そのインスタンスが別のスレッドで追加する可能性があるため、追加しない。
+    // (parseBatch()のパース中は、そのスレッドの領域に追加する。)
+    if (_string_arenas.empty() || (!_append_to_shared_arena && _string_arenas.back().use_count() > 1)) {
+        const auto upstream = _getMemoryResource();
+        _string_arenas.push_back(std::allocate_shared<_StringArena>(std::pmr::polymorphic_allocator<>(upstream),
+                                                                    upstream));
     }
-    _options.try_emplace(option_name_, value_);
+    return _string_arenas.back()->copy(str_);
+}
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::ParseResult::_makeStringValue(
+    const std::string_view str_, const _StringStorage storage_) {
+    if (storage_ == _StringStorage::REFERENCE) { return OptionValue::createInstance(str_); }
+    // 値ごとに確保せず、文字列領域(RESULTの場合は結果が保持する領域)を参照する。
+    const auto stored = storage_ == _StringStorage::COPY ? _copyString(str_) : str_;
+    if (_memory_resource != nullptr) { return OptionValue::createInstance(stored); }
+    // メモリリソースが指定されていない場合、取得したOptionValueは従来通り文字列を所有する。
+    return OptionValue(OptionValue::VContainer::createResultString(stored));
 }
 
-void net_ln3::cpp_lib::ArgumentParser::_addArgument(const std::string& value_) { _args.push_back(value_); }
+net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::ParseResult::_makeLazyValue(
+    const std::string_view str_, const OptionType type_, const _StringStorage storage_) {
+    const auto type = type_ == OptionType::SIGNED
+                          ? OptionValue::VContainer::Type::SIGNED
+                          : type_ == OptionType::UNSIGNED
+                          ? OptionValue::VContainer::Type::UNSIGNED
+                          : OptionValue::VContainer::Type::LONG_DOUBLE;
+    return OptionValue(OptionValue::VContainer::createLazy(
+        type, storage_ == _StringStorage::COPY ? _copyString(str_) : str_));
+}
 
-void net_ln3::cpp_lib::ArgumentParser::_addInvalidOption(const std::string& option_name_,
-                                                         const std::string& value_) {
-    if (_invalid_options.contains(option_name_)) {
-        _invalid_options.at(option_name_).emplace_back(value_);
-        return;
-    }
-    _invalid_options.try_emplace(option_name_, std::vector({value_}));
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_OptionList::_OptionList(std::pmr::memory_resource* resource_)
+    : strings(resource_), signed_values(resource_), unsigned_values(resource_), long_double_values(resource_) {
 }
 
-void net_ln3::cpp_lib::ArgumentParser::_addInvalidOptionType(const std::string& option_name_,
-                                                             const std::string& value_,
-                                                             OptionType type_) {
-    if (_invalid_option_types.contains(option_name_)) {
-        _invalid_option_types.at(option_name_).emplace_back(value_, type_);
-        return;
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_OptionList::reserveExpected() {
+    if (expected_count == 0) { return; }
+    switch (type) {
+    case OptionType::STRING_LIST:
+        strings.reserve(strings.size() + expected_count);
+        break;
+    case OptionType::SIGNED_LIST:
+        signed_values.reserve(signed_values.size() + expected_count);
+        break;
+    case OptionType::UNSIGNED_LIST:
+        unsigned_values.reserve(unsigned_values.size() + expected_count);
+        break;
+    case OptionType::LONG_DOUBLE_LIST:
+        long_double_values.reserve(long_double_values.size() + expected_count);
+        break;
+    default:
+        break;
     }
-    _invalid_option_types.try_emplace(option_name_,
-                                      std::vector<std::pair<std::string, OptionType>>({{value_, type_}}));
+    expected_count = 0;
 }
 
-void net_ln3::cpp_lib::ArgumentParser::_addInvalidAlias(const std::string& alias_name_,
-                                                        const std::string& value_) {
-    if (_invalid_alias.contains(alias_name_)) {
-        _invalid_alias.at(alias_name_).emplace_back(value_);
-        return;
+bool net_ln3::cpp_lib::ArgumentParser::ParseResult::_OptionList::isEmpty() const noexcept {
+    return strings.empty() && signed_values.empty() && unsigned_values.empty() && long_double_values.empty();
+}
+
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_OptionList::clear() noexcept {
+    strings.clear();
+    signed_values.clear();
+    unsigned_values.clear();
+    long_double_values.clear();
+    expected_count = 0;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_OptionList&
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_getOptionList(const std::string_view option_name_,
+                                                              const OptionType type_) {
+    auto found = _option_lists.find(option_name_);
+    if (found == _option_lists.end()) {
+        const auto resource = _option_lists.get_allocator().resource();
+        found = _option_lists.try_emplace(std::pmr::string(option_name_, resource), resource).first;
     }
-    _invalid_alias.try_emplace(alias_name_, std::vector({value_}));
+    found->second.type = type_;
+    return found->second;
 }
 
-bool net_ln3::cpp_lib::ArgumentParser::_isValidType(const std::string& value_,
-                                                    const OptionType type_) {
+bool net_ln3::cpp_lib::ArgumentParser::ParseResult::_appendListValue(const std::string_view option_name_,
+                                                                     const std::string_view value_,
+                                                                     const OptionType type_,
+                                                                     const _StringStorage storage_) {
     using sv = ParseUtil::StringValidator;
+    auto& list = _getOptionList(option_name_, type_);
+    if (_takeFallbackOption(option_name_)) { list.clear(); }
+    else if (list.isEmpty()) { _recordFallbackOption(option_name_); }
     switch (type_) {
-    case OptionType::STRING:
+    case OptionType::STRING_LIST:
+        list.strings.push_back(storage_ == _StringStorage::COPY ? _copyString(value_) : value_);
         return true;
-    case OptionType::SIGNED:
-        return sv::isValidSigned(value_);
-    case OptionType::UNSIGNED:
-        return sv::isValidUnsigned(value_);
-    case OptionType::LONG_DOUBLE:
-        return sv::isValidLongDouble(value_);
-    case OptionType::BOOLEAN:
-        return sv::isValidBoolean(value_);
-    case OptionType::NULLITY:
+    case OptionType::SIGNED_LIST:
+        if (const auto v = sv::parseSigned(value_); v.has_value()) {
+            list.signed_values.push_back(*v);
+            return true;
+        }
+        return false;
+    case OptionType::UNSIGNED_LIST:
+        if (const auto v = sv::parseUnsigned(value_); v.has_value()) {
+            list.unsigned_values.push_back(*v);
+            return true;
+        }
+        return false;
+    case OptionType::LONG_DOUBLE_LIST:
+        if (const auto v = sv::parseLongDouble(value_); v.has_value()) {
+            list.long_double_values.push_back(*v);
+            return true;
+        }
         return false;
     default:
-        break;
+        return false;
     }
-    return false;
 }
 
-net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::_convertOptionValue(
-    const std::string& value_, const OptionType type_) {
-    OptionValue ov;
+size_t net_ln3::cpp_lib::ArgumentParser::ParseResult::_addArrayOption(const std::string_view option_name_,
+                                                                      const std::string_view value_,
+                                                                      const OptionType type_,
+                                                                      const _StringStorage name_storage_) {
+    using sv = ParseUtil::StringValidator;
+    using VType = OptionValue::VContainer::Type;
+    const size_t count = sv::countArrayElements(value_);
+    size_t bad_index;
+    OptionValue::VContainer container(nullptr);
     switch (type_) {
-    case OptionType::STRING:
-        ov = OptionValue::createInstance(value_);
+    case OptionType::SIGNED_ARRAY:
+        container = OptionValue::VContainer::createArray(VType::SIGNED_ARRAY, count);
+        bad_index = sv::parseSignedArray(value_, container.getSignedArray());
         break;
-    case OptionType::SIGNED:
-        ov = OptionValue::createInstance(std::stoll(value_));
+    case OptionType::UNSIGNED_ARRAY:
+        container = OptionValue::VContainer::createArray(VType::UNSIGNED_ARRAY, count);
+        bad_index = sv::parseUnsignedArray(value_, container.getUnsignedArray());
+        break;
+    case OptionType::LONG_DOUBLE_ARRAY:
+        container = OptionValue::VContainer::createArray(VType::LONG_DOUBLE_ARRAY, count);
+        bad_index = sv::parseLongDoubleArray(value_, container.getLongDoubleArray());
+        break;
+    default:
+        return 0;
+    }
+    if (bad_index == sv::ARRAY_VALID) { _addOption(option_name_, OptionValue(std::move(container)), name_storage_); }
+    return bad_index;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_addDiagnostic(const Diagnostic::Kind kind_,
+                                                                   const std::string_view name_,
+                                                                   const std::string_view value_,
+                                                                   const OptionType type_,
+                                                                   const _StringStorage storage_,
+                                                                   const _StringStorage name_storage_,
+                                                                   const size_t element_index_) {
+    // 値を表す引数は、_token_countを増やした後に処理される。
+    _diagnostics.push_back({
+        kind_, type_, _token_count - 1, name_storage_ == _StringStorage::COPY ? _copyString(name_) : name_,
+        storage_ == _StringStorage::COPY ? _copyString(value_) : value_, element_index_
+    });
+}
+
+void net_ln3::cpp_lib::ArgumentParser::ParseResult::_recordFallbackOption(const std::string_view option_name_) {
+    if (_applying_fallback) { _fallback_options.push_back(_copyString(option_name_)); }
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::ParseResult::_takeFallbackOption(const std::string_view option_name_) {
+    // 適用中の重複(ファイル内で重複したキーなど)は、置き換えずに誤りとして記録する。
+    if (_applying_fallback || _fallback_options.empty()) { return false; }
+    const auto found = std::ranges::find(_fallback_options, option_name_);
+    if (found == _fallback_options.end()) { return false; }
+    _fallback_options.erase(found);
+    return true;
+}
+
+const net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnostics&
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_getGroupedDiagnostics() const {
+    std::lock_guard lock(_grouped_diagnostics.mutex);
+    auto& table = _grouped_diagnostics.table;
+    // 以前に取得した参照が無効にならないよう、表を作り直さずに、まだ追加していない誤りのみを追加する。
+    const auto pending = std::span(_diagnostics).subspan(table.count);
+    for (const auto& [kind, type, index, name, value, element_index] : pending) {
+        switch (kind) {
+        case Diagnostic::Kind::INVALID_OPTION:
+            table.invalid_options[std::string(name)].emplace_back(value);
+            break;
+        case Diagnostic::Kind::INVALID_OPTION_TYPE:
+            table.invalid_option_types[std::string(name)].emplace_back(value, type);
+            break;
+        case Diagnostic::Kind::INVALID_ALIAS:
+            table.invalid_alias[std::string(name)].emplace_back(value);
+            break;
+        }
+    }
+    table.count = _diagnostics.size();
+    return table;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache::_GroupedDiagnosticsCache(
+    const _GroupedDiagnosticsCache& other_) {
+    std::lock_guard lock(other_.mutex);
+    table = other_.table;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache::_GroupedDiagnosticsCache(
+    _GroupedDiagnosticsCache&& other_) noexcept : table(std::move(other_.table)) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache&
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache::operator=(
+    const _GroupedDiagnosticsCache& other_) {
+    if (this != &other_) {
+        std::scoped_lock lock(mutex, other_.mutex);
+        table = other_.table;
+    }
+    return *this;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache&
+net_ln3::cpp_lib::ArgumentParser::ParseResult::_GroupedDiagnosticsCache::operator=(
+    _GroupedDiagnosticsCache&& other_) noexcept {
+    table = std::move(other_.table);
+    return *this;
+}
+
+net_ln3::cpp_lib::ArgumentParser::Schema::Schema() = default;
+
+net_ln3::cpp_lib::ArgumentParser::Schema::Schema(OptionNames type_, OptionAlias alias_)
+    : _option_names(std::move(type_)), _alias(std::move(alias_)), _option_mapper_mode(true),
+      _has_option_lists(std::ranges::any_of(_option_names._name_type_table | std::views::values, _isListType)) {
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::freeze() {
+    if (_static_option_table.has_value() || _frozen_option_table.has_value()) { return; }
+    _frozen_option_table = FrozenOptionTable(_option_names, _alias);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::enableResponseFiles(const size_t max_depth_) {
+    _response_file_depth = max_depth_;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::enableLazyConversion() { _lazy_conversion = true; }
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::enableEnvironment(std::string prefix_) {
+    _environment_prefix = std::move(prefix_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::enableConfigFile(std::filesystem::path path_) {
+    _config_file = std::move(path_);
+    // 以前の設定でマップしたファイルは、その設定を共有しているコピーが引き続き使用する。
+    _config_file_cache = std::make_shared<_ConfigFileCache>();
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::enableAbbreviation() {
+    freeze();
+    _abbreviation = true;
+}
+
+size_t net_ln3::cpp_lib::ArgumentParser::Schema::complete(const std::string_view token_,
+                                                          std::vector<std::string_view>& completions_) const {
+    if (!_frozen_option_table.has_value() || token_.empty() || token_.front() != '-') { return 0; }
+    // 入力途中の`-`や`--`のみの引数も補完するため、classifyToken()は使用しない。
+    if (token_.starts_with("--")) { return _frozen_option_table->completeOption(token_.substr(2), completions_); }
+    return _frozen_option_table->completeAlias(token_.substr(1), completions_);
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult net_ln3::cpp_lib::ArgumentParser::Schema::parse(
+    const std::vector<std::string>& args_) const {
+    ParseResult result;
+    parse(args_, result);
+    return result;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult net_ln3::cpp_lib::ArgumentParser::Schema::parse(
+    const int argc_, const char* const argv_[]) const {
+    ParseResult result;
+    parse(argc_, argv_, result);
+    return result;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parse(const std::vector<std::string>& args_,
+                                                     ParseResult& result_) const {
+    _reserveOptionLists(args_, result_);
+    _ParseState state;
+    state.storage = ParseResult::_StringStorage::COPY;
+    for (const auto& arg : args_) { _parseArgument(arg, state, result_); }
+    _applyFallbackSources(result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parse(const int argc_, const char* const argv_[],
+                                                     ParseResult& result_) const {
+    _reserveOptionLists(std::span(argv_, argc_), result_);
+    _ParseState state;
+    state.storage = ParseResult::_StringStorage::COPY;
+    for (int i = 0; i < argc_; i++) { _parseArgument(argv_[i], state, result_); }
+    _applyFallbackSources(result_);
+}
+
+template <class R>
+void net_ln3::cpp_lib::ArgumentParser::Schema::_reserveOptionLists(const R& args_, ParseResult& result_) const {
+    if (!_has_option_lists) { return; }
+    // _parseToken()と同じ規則で、値を表す引数を読み飛ばしながら数える。
+    bool value_next = false;
+    for (const auto& arg : args_) {
+        if (std::exchange(value_next, false)) { continue; }
+        const std::string_view token(arg);
+        const auto [kind, name_offset] = classifyToken(token);
+        if (kind == TokenKind::ARGUMENT) { continue; }
+        std::optional<OptionType> type;
+        std::string_view name;
+        bool inline_value = false;
+        if (kind == TokenKind::OPTION) {
+            name = token.substr(name_offset);
+            if (const size_t separator = name.find('='); separator != 0 && separator != std::string_view::npos) {
+                name = name.substr(0, separator);
+                inline_value = true;
+            }
+            type = _resolveOption(name);
+        }
+        else {
+            name = _findAliasTarget(token.substr(name_offset), type);
+            if (name.empty()) { name = _findAliasBundle(token.substr(name_offset), type); }
+        }
+        value_next = !inline_value && type != OptionType::BOOLEAN;
+        if (type.has_value() && _isListType(*type) && !name.empty()) {
+            result_._getOptionList(name, *type).expected_count++;
+        }
+    }
+    for (auto& list : result_._option_lists | std::views::values) { list.reserveExpected(); }
+}
+
+template <class F>
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::Schema::_invokeNoexcept(
+    F&& parse_, const ParseResult& result_) noexcept {
+#if NET_LN3_CPP_LIB_EXCEPTIONS
+    try { parse_(); }
+    catch (const std::bad_alloc&) { return ErrorCode::OUT_OF_MEMORY; }
+#else
+    parse_();
+#endif
+    return result_.hasErrors() ? ErrorCode::INVALID_ARGUMENTS : ErrorCode::NONE;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::Schema::tryParse(
+    const std::span<const std::string_view> args_, ParseResult& result_) const noexcept {
+    return _invokeNoexcept([this, args_, &result_] {
+        _reserveOptionLists(args_, result_);
+        _ParseState state;
+        state.storage = ParseResult::_StringStorage::COPY;
+        for (const auto& arg : args_) { _parseArgument(arg, state, result_); }
+        _applyFallbackSources(result_);
+    }, result_);
+}
+
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::Schema::tryParse(
+    const int argc_, const char* const argv_[], ParseResult& result_) const noexcept {
+    return _invokeNoexcept([this, argc_, argv_, &result_] { parse(argc_, argv_, result_); }, result_);
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult net_ln3::cpp_lib::ArgumentParser::Schema::parseView(
+    const std::span<const std::string_view> args_) const {
+    ParseResult result;
+    parseView(args_, result);
+    return result;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ParseResult net_ln3::cpp_lib::ArgumentParser::Schema::parseView(
+    const int argc_, const char* const argv_[]) const {
+    ParseResult result;
+    parseView(argc_, argv_, result);
+    return result;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parseView(const std::span<const std::string_view> args_,
+                                                         ParseResult& result_) const {
+    _reserveOptionLists(args_, result_);
+    _ParseState state;
+    for (const auto& arg : args_) { _parseArgument(arg, state, result_); }
+    _applyFallbackSources(result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parseView(const int argc_, const char* const argv_[],
+                                                         ParseResult& result_) const {
+    _reserveOptionLists(std::span(argv_, argc_), result_);
+    _ParseState state;
+    for (int i = 0; i < argc_; i++) { _parseArgument(argv_[i], state, result_); }
+    _applyFallbackSources(result_);
+}
+
+std::vector<net_ln3::cpp_lib::ArgumentParser::ParseResult> net_ln3::cpp_lib::ArgumentParser::Schema::parseBatch(
+    const std::span<const std::vector<std::string>> batch_, const size_t thread_count_) const {
+    std::vector<ParseResult> results(batch_.size());
+    const size_t chunk_count = (batch_.size() + _BATCH_CHUNK_SIZE - 1) / _BATCH_CHUNK_SIZE;
+    const size_t thread_count = std::min(thread_count_ != 0
+                                             ? thread_count_
+                                             : std::max<size_t>(std::thread::hardware_concurrency(), 1),
+                                         chunk_count);
+    std::atomic<size_t> next_chunk = 0;
+    const auto parse_chunks = [this, batch_, &results, chunk_count, &next_chunk] {
+        // スレッドごとの文字列領域。このスレッドでパースした結果で共有する。
+        const auto arena = std::make_shared<ParseResult::_StringArena>(std::pmr::get_default_resource());
+        for (size_t chunk = next_chunk++; chunk < chunk_count; chunk = next_chunk++) {
+            const size_t end = std::min((chunk + 1) * _BATCH_CHUNK_SIZE, batch_.size());
+            for (size_t i = chunk * _BATCH_CHUNK_SIZE; i < end; i++) {
+                results[i]._string_arenas.push_back(arena);
+                results[i]._append_to_shared_arena = true;
+                parse(batch_[i], results[i]);
+                results[i]._append_to_shared_arena = false;
+            }
+        }
+    };
+#if NET_LN3_CPP_LIB_EXCEPTIONS
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+    const auto worker = [&parse_chunks, chunk_count, &next_chunk, &exception_mutex, &exception] {
+        try { parse_chunks(); }
+        catch (...) {
+            std::lock_guard lock(exception_mutex);
+            if (!exception) { exception = std::current_exception(); }
+            // 残りの要素を他のスレッドが処理しないようにする。
+            next_chunk = chunk_count;
+        }
+    };
+#else
+    const auto& worker = parse_chunks;
+#endif
+    std::vector<std::thread> threads;
+#if NET_LN3_CPP_LIB_EXCEPTIONS
+    try { for (size_t i = 1; i < thread_count; i++) { threads.emplace_back(worker); } }
+    catch (...) {
+        // 開始済みのスレッドを終了させずに破棄するとstd::terminate()が呼ばれるため、終了を待ってから再送出する。
+        next_chunk = chunk_count;
+        for (auto& thread : threads) { thread.join(); }
+        throw;
+    }
+#else
+    for (size_t i = 1; i < thread_count; i++) { threads.emplace_back(worker); }
+#endif
+    worker();
+    for (auto& thread : threads) { thread.join(); }
+#if NET_LN3_CPP_LIB_EXCEPTIONS
+    if (exception) { std::rethrow_exception(exception); }
+#endif
+    return results;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parseCommandLine(const std::string_view command_,
+                                                                ParseResult& result_) const {
+    _parseCommandLine(command_, ParseResult::_StringStorage::COPY, result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::parseCommandLineView(const std::string_view command_,
+                                                                    ParseResult& result_) const {
+    _parseCommandLine(command_, ParseResult::_StringStorage::REFERENCE, result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::feed(const std::string_view token_, ParseResult& result_) const {
+    auto& pending = result_._pending;
+    _ParseState state;
+    state.storage = ParseResult::_StringStorage::COPY;
+    if (pending.option_value_flag) {
+        state.option_value_flag = true;
+        state.option_name = pending.option_name;
+        state.alias_name = pending.alias_name;
+        state.option_type = pending.option_type;
+    }
+    _parseArgument(token_, state, result_);
+    pending.option_value_flag = state.option_value_flag;
+    if (!state.option_value_flag) { return; }
+    // 名称はtoken_を参照している可能性があるため、次の呼び出しまで保持できるようコピーする。
+    if (state.option_name.data() != pending.option_name.data()) { pending.option_name.assign(state.option_name); }
+    if (state.alias_name.data() != pending.alias_name.data()) { pending.alias_name.assign(state.alias_name); }
+    pending.option_type = state.option_type;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::finish(ParseResult& result_) const {
+    result_._pending.option_value_flag = false;
+    _applyFallbackSources(result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_parseCommandLine(const std::string_view command_,
+                                                                 const ParseResult::_StringStorage storage_,
+                                                                 ParseResult& result_) const {
+    _ParseState state;
+    ParseUtil::ShellTokenizer tokenizer(command_);
+    while (tokenizer.next()) {
+        // 引用符を取り除いた引数はtokenizerのバッファを参照するため、結果の文字列領域に一度だけコピーする。
+        if (tokenizer.isUnescaped()) {
+            state.storage = ParseResult::_StringStorage::RESULT;
+            _parseArgument(result_._copyString(tokenizer.getToken()), state, result_);
+        }
+        else {
+            state.storage = storage_;
+            _parseArgument(tokenizer.getToken(), state, result_);
+        }
+    }
+    _applyFallbackSources(result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_parseArgument(const std::string_view arg_, _ParseState& state_,
+                                                              ParseResult& result_, const size_t depth_,
+                                                              const std::filesystem::path& directory_) const {
+    if (depth_ >= _response_file_depth || arg_.size() < 2 || arg_.front() != '@') {
+        _parseToken(arg_, state_, result_);
+        return;
+    }
+    const auto name = arg_.substr(1);
+    auto path = std::filesystem::path(std::u8string_view(reinterpret_cast<const char8_t*>(name.data()), name.size()));
+    if (path.is_relative() && !directory_.empty()) { path = directory_ / path; }
+    auto file = std::make_shared<const multi_platform::MappedFile>(path);
+    // 開けなかった場合は、通常の引数として扱う。
+    if (!file->isOpen()) {
+        _parseToken(arg_, state_, result_);
+        return;
+    }
+    // 引数や値はマップした内容を参照するため、途中で例外が送出されても参照先が残るよう、先に結果へ登録する。
+    const std::string_view content = file->getView();
+    result_._mapped_files.push_back(std::move(file));
+    const auto storage = state_.storage;
+    const auto directory = path.parent_path();
+    ParseUtil::ShellTokenizer tokenizer(content);
+    while (tokenizer.next()) {
+        // 引用符を取り除いた引数はtokenizerのバッファを参照するため、結果の文字列領域にコピーする。
+        const auto token = tokenizer.isUnescaped() ? result_._copyString(tokenizer.getToken()) : tokenizer.getToken();
+        state_.storage = ParseResult::_StringStorage::RESULT;
+        _parseArgument(token, state_, result_, depth_ + 1, directory);
+    }
+    state_.storage = storage;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_parseToken(const std::string_view arg_, _ParseState& state_,
+                                                           ParseResult& result_) const {
+    result_._token_count++;
+    // オプションを登録する。
+    if (state_.option_value_flag) {
+        _parseOptionValue(arg_, state_, result_);
+        return;
+    }
+    // オプション名を取得する。オプションの型は、ここで一度だけ検索する。
+    const auto [kind, name_offset] = classifyToken(arg_);
+    if (kind == TokenKind::OPTION) {
+        state_.option_name = arg_.substr(name_offset);
+        // `--name=value`の場合は、名称と値を引数の上で分割し、値をそのまま処理する。
+        const size_t separator = state_.option_name.find('=');
+        const bool has_value = separator != 0 && separator != std::string_view::npos;
+        const auto value = has_value ? state_.option_name.substr(separator + 1) : std::string_view();
+        if (has_value) { state_.option_name = state_.option_name.substr(0, separator); }
+        const auto token_name = state_.option_name.data();
+        state_.option_type = _resolveOption(state_.option_name);
+        // 省略形から解決した名称はSchemaが保持する文字列のため、結果に格納する場合はコピーする。
+        state_.name_storage = state_.option_name.data() == token_name
+                                  ? state_.storage
+                                  : ParseResult::_StringStorage::COPY;
+        if (has_value) {
+            _parseOptionValue(value, state_, result_);
+            return;
+        }
+    }
+    else if (kind == TokenKind::ALIAS) {
+        // エイリアス名でオプションが指定されている場合、それをオプション名に変換する。
+        state_.alias_name = arg_.substr(name_offset);
+        state_.option_name = _findAliasTarget(state_.alias_name, state_.option_type);
+        state_.name_storage = ParseResult::_StringStorage::COPY;
+        // `-abc`が1つのエイリアスでない場合は、`-a -b -c`として扱う。最後以外のエイリアスは真偽型に限る。
+        if (state_.option_name.empty()) {
+            std::optional<OptionType> last_type;
+            if (const auto last_name = _findAliasBundle(state_.alias_name, last_type); !last_name.empty()) {
+                std::optional<OptionType> type;
+                for (size_t i = 0; i + 1 < state_.alias_name.size(); i++) {
+                    result_._addOption(_findAliasTarget(state_.alias_name.substr(i, 1), type),
+                                       OptionValue::createInstance(true), ParseResult::_StringStorage::COPY);
+                }
+                state_.alias_name = state_.alias_name.substr(state_.alias_name.size() - 1);
+                state_.option_name = last_name;
+                state_.option_type = last_type;
+            }
+        }
+    }
+    else {
+        result_._addArgument(arg_, state_.storage);
+        return;
+    }
+    // オプションが真偽型の場合、フラグとして扱う。
+    if (state_.option_type == OptionType::BOOLEAN) {
+        result_._addOption(state_.option_name, OptionValue::createInstance(true), state_.name_storage);
+        state_.option_name = {};
+        state_.alias_name = {};
+        state_.option_type.reset();
+    }
+    else {
+        // オプション<フラグ>以外では次の入力をオプションの値とする
+        state_.option_value_flag = true;
+    }
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_parseOptionValue(const std::string_view value_, _ParseState& state_,
+                                                                 ParseResult& result_) const {
+    using Kind = ParseResult::Diagnostic::Kind;
+    // マッピングモードでない場合。(従来の動作)
+    if (!_option_mapper_mode) {
+        if (state_.option_name.empty()) {
+            result_._addDiagnostic(Kind::INVALID_ALIAS, state_.alias_name, value_, OptionType::NULLITY,
+                                   state_.storage, state_.storage);
+        }
+        else {
+            result_._addOption(state_.option_name, result_._makeStringValue(value_, state_.storage),
+                               state_.name_storage);
+        }
+        // エイリアス名が存在しない場合
+    }
+    else if (state_.option_name.empty()) {
+        // エイリアス名は引数の一部である。(feed()では、保持している名称のため常にCOPYである。)
+        result_._addDiagnostic(Kind::INVALID_ALIAS, state_.alias_name, value_, OptionType::NULLITY, state_.storage,
+                               state_.storage);
+        // オプション名が存在する場合
+    }
+    else if (state_.option_type.has_value()) {
+        _storeOptionValue(state_.option_name, value_, *state_.option_type, state_, result_);
+        // オプション名が存在しない場合
+    }
+    else {
+        result_._addDiagnostic(Kind::INVALID_OPTION, state_.option_name, value_, OptionType::NULLITY,
+                               state_.storage, state_.name_storage);
+    }
+    state_.option_name = {};
+    state_.alias_name = {};
+    state_.option_type.reset();
+    state_.option_value_flag = false;
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::Schema::_findAliasBundle(const std::string_view bundle_,
+                                                                            std::optional<OptionType>& type_) const {
+    type_.reset();
+    if (bundle_.size() < 2) { return {}; }
+    std::optional<OptionType> type;
+    for (size_t i = 0; i + 1 < bundle_.size(); i++) {
+        if (_findAliasTarget(bundle_.substr(i, 1), type).empty() || type != OptionType::BOOLEAN) { return {}; }
+    }
+    const auto name = _findAliasTarget(bundle_.substr(bundle_.size() - 1), type);
+    if (name.empty() || !type.has_value()) { return {}; }
+    type_ = type;
+    return name;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_storeOptionValue(const std::string_view option_name_,
+                                                                 const std::string_view value_,
+                                                                 const OptionType type_, const _ParseState& state_,
+                                                                 ParseResult& result_) const {
+    using Kind = ParseResult::Diagnostic::Kind;
+    if (_isListType(type_)) {
+        // 複数の値を持つオプションは、重複として扱わずに値を追加する。
+        if (!result_._appendListValue(option_name_, value_, type_, state_.storage)) {
+            result_._addDiagnostic(Kind::INVALID_OPTION_TYPE, option_name_, value_, type_, state_.storage,
+                                   state_.name_storage);
+        }
+    }
+    else if (_isArrayType(type_)) {
+        // 配列は値全体ではなく、最初の不正な要素の位置を記録する。
+        if (const size_t bad_index = result_._addArrayOption(option_name_, value_, type_, state_.name_storage);
+            bad_index != ParseUtil::StringValidator::ARRAY_VALID) {
+            result_._addDiagnostic(Kind::INVALID_OPTION_TYPE, option_name_, value_, type_, state_.storage,
+                                   state_.name_storage, bad_index);
+        }
+    }
+    else if (auto value = _convertOptionValue(value_, type_, state_, result_); value.has_value()) {
+        result_._addOption(option_name_, std::move(*value), state_.name_storage);
+    }
+    else {
+        // 型検証に失敗したオプションを登録する。
+        result_._addDiagnostic(Kind::INVALID_OPTION_TYPE, option_name_, value_, type_, state_.storage,
+                               state_.name_storage);
+    }
+}
+
+namespace {
+    /**
+     * @brief 設定ファイルの行・キー・値の前後から、空白と`\r`を取り除きます。
+     */
+    std::string_view trimConfigSpace(std::string_view str_) {
+        const auto is_space = [](const char c_) { return c_ == ' ' || c_ == '\t' || c_ == '\r'; };
+        while (!str_.empty() && is_space(str_.front())) { str_.remove_prefix(1); }
+        while (!str_.empty() && is_space(str_.back())) { str_.remove_suffix(1); }
+        return str_;
+    }
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_applyFallbackSources(ParseResult& result_) const {
+    // 以降のパースで引数の値と重複しないよう、結果ごとに一度だけ適用する。
+    if (result_._fallback_applied) { return; }
+    result_._fallback_applied = true;
+    result_._applying_fallback = true;
+    // 既に値を持つオプションは上書きしないため、優先順位の高いものから適用する。
+    _applyEnvironment(result_);
+    _applyConfigFile(result_);
+    result_._applying_fallback = false;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_applyEnvironment(ParseResult& result_) const {
+    if (!_environment_prefix.has_value()) { return; }
+    const auto environment = multi_platform::getEnvironment();
+    if (environment == nullptr) { return; }
+    const std::string_view prefix = *_environment_prefix;
+    // 環境変数はパース後に変更される可能性があるため、値はコピーする。
+    _ParseState state;
+    state.storage = ParseResult::_StringStorage::COPY;
+    // 変換したオプション名の格納先。変数ごとに確保しないよう再利用する。
+    std::string option_name;
+    for (auto entry = environment; *entry != nullptr; entry++) {
+        const std::string_view variable(*entry);
+        const size_t separator = variable.find('=');
+        if (separator == std::string_view::npos || separator <= prefix.size() || !variable.starts_with(prefix)) {
+            continue;
+        }
+        option_name.assign(variable.substr(prefix.size(), separator - prefix.size()));
+        for (char& c : option_name) {
+            if (c == '_') { c = '-'; }
+            else if (c >= 'A' && c <= 'Z') { c = static_cast<char>(c - 'A' + 'a'); }
+        }
+        const auto type = _findOptionType(option_name);
+        // 登録されていない名称は、アプリケーションと無関係な変数である可能性があるため、誤りとして扱わない。
+        if (!type.has_value()) { continue; }
+        // 引数で指定されたオプションを優先する。
+        if (_isListType(*type)) {
+            const auto list = result_._option_lists.find(std::string_view(option_name));
+            if (list != result_._option_lists.end() && !list->second.isEmpty()) { continue; }
+        }
+        else if (result_.isExistOption(option_name)) { continue; }
+        const size_t diagnostic_count = result_._diagnostics.size();
+        _storeOptionValue(option_name, variable.substr(separator + 1), *type, state, result_);
+        // 引数に由来しない誤りであることを表す。
+        if (result_._diagnostics.size() != diagnostic_count) { result_._diagnostics.back().token_index = SIZE_MAX; }
+    }
+}
+
+void net_ln3::cpp_lib::ArgumentParser::Schema::_applyConfigFile(ParseResult& result_) const {
+    using Kind = ParseResult::Diagnostic::Kind;
+    if (_config_file_cache == nullptr || !_option_mapper_mode) { return; }
+    const auto& config = _loadConfigFile();
+    if (config.file == nullptr) { return; }
+    // キーと値はマップした内容を参照するため、結果が破棄されるまでマップを保持する。
+    result_._mapped_files.push_back(config.file);
+    _ParseState state;
+    state.storage = ParseResult::_StringStorage::RESULT;
+    state.name_storage = ParseResult::_StringStorage::RESULT;
+    // このファイルで値を格納したキー。より優先される指定と、ファイル内での重複を区別するために使用する。
+    std::unordered_set<std::string_view> file_keys;
+    const size_t diagnostic_count = result_._diagnostics.size();
+    for (const auto& [key, value, has_separator] : config.lines) {
+        if (!has_separator) {
+            result_._addDiagnostic(Kind::INVALID_OPTION, key, {}, OptionType::NULLITY, state.storage,
+                                   state.name_storage);
+            continue;
+        }
+        const auto type = _findOptionType(key);
+        if (!type.has_value()) {
+            result_._addDiagnostic(Kind::INVALID_OPTION, key, value, OptionType::NULLITY, state.storage,
+                                   state.name_storage);
+            continue;
+        }
+        // 複数の値を持つオプション以外は、ファイル内での重複を_addOption()が誤りとして記録する。
+        if (!file_keys.contains(key)) {
+            if (_isListType(*type)) {
+                const auto list = result_._option_lists.find(key);
+                if (list != result_._option_lists.end() && !list->second.isEmpty()) { continue; }
+            }
+            else if (result_.isExistOption(key)) { continue; }
+            file_keys.insert(key);
+        }
+        _storeOptionValue(key, value, *type, state, result_);
+    }
+    // 引数に由来しない誤りであることを表す。
+    for (size_t i = diagnostic_count; i < result_._diagnostics.size(); i++) {
+        result_._diagnostics[i].token_index = SIZE_MAX;
+    }
+}
+
+const net_ln3::cpp_lib::ArgumentParser::Schema::_ConfigFileCache&
+net_ln3::cpp_lib::ArgumentParser::Schema::_loadConfigFile() const {
+    // パース中は設定を変更しないが、複数のスレッドが同時に最初の適用を行う場合があるため、一度だけ作成する。
+    auto& cache = *_config_file_cache;
+    std::call_once(cache.once, [this, &cache] {
+        auto file = std::make_shared<const multi_platform::MappedFile>(_config_file);
+        if (!file->isOpen()) { return; }
+        const std::string_view content = file->getView();
+        for (size_t begin = 0; begin < content.size();) {
+            const size_t end = std::min(content.find('\n', begin), content.size());
+            const std::string_view line = trimConfigSpace(content.substr(begin, end - begin));
+            begin = end + 1;
+            if (line.empty() || line.front() == '#') { continue; }
+            const size_t separator = line.find('=');
+            if (separator == std::string_view::npos) {
+                cache.lines.push_back({line, {}, false});
+                continue;
+            }
+            cache.lines.push_back({
+                trimConfigSpace(line.substr(0, separator)), trimConfigSpace(line.substr(separator + 1)), true
+            });
+        }
+        cache.file = std::move(file);
+    });
+    return cache;
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::OptionType>
+net_ln3::cpp_lib::ArgumentParser::Schema::_findOptionType(const std::string_view option_name_) const {
+    const auto type = _findOwnOptionType(option_name_);
+    if (type.has_value() || _fallback_schema == nullptr) { return type; }
+    return _fallback_schema->_findOptionType(option_name_);
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::OptionType>
+net_ln3::cpp_lib::ArgumentParser::Schema::_resolveOption(std::string_view& option_name_) const {
+    auto type = _findOptionType(option_name_);
+    if (type.has_value() || !_abbreviation || !_frozen_option_table.has_value()) { return type; }
+    bool ambiguous = false;
+    const auto entry = _frozen_option_table->resolveOptionPrefix(option_name_, ambiguous);
+    // 複数のオプションに一致する省略形は、登録されていないオプションとして扱う。
+    if (!entry.has_value()) { return std::nullopt; }
+    option_name_ = entry->name;
+    return entry->type != OptionType::NULLITY ? entry->type : OptionType();
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::OptionType>
+net_ln3::cpp_lib::ArgumentParser::Schema::_findOwnOptionType(const std::string_view option_name_) const {
+    if (_static_option_table.has_value()) {
+        const auto spec = _static_option_table->findOption(option_name_);
+        if (spec == nullptr) { return std::nullopt; }
+        return spec->type != OptionType::NULLITY ? spec->type : OptionType();
+    }
+    if (_frozen_option_table.has_value()) {
+        const auto entry = _frozen_option_table->findOption(option_name_);
+        if (!entry.has_value()) { return std::nullopt; }
+        return entry->type != OptionType::NULLITY ? entry->type : OptionType();
+    }
+    const auto type = _option_names.findOptionType(option_name_);
+    if (type == nullptr) { return std::nullopt; }
+    return *type != OptionType::NULLITY ? *type : OptionType();
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::Schema::_findAliasTarget(const std::string_view alias_name_,
+                                                                            std::optional<OptionType>& type_) const {
+    const auto option_name = _findOwnAliasTarget(alias_name_, type_);
+    if (!option_name.empty() || _fallback_schema == nullptr) { return option_name; }
+    return _fallback_schema->_findAliasTarget(alias_name_, type_);
+}
+
+std::string_view net_ln3::cpp_lib::ArgumentParser::Schema::_findOwnAliasTarget(const std::string_view alias_name_,
+                                                                               std::optional<OptionType>& type_) const {
+    // 表を使用する場合は、エイリアスの検索と同時にオプションの型も取得する。
+    if (_static_option_table.has_value()) {
+        const auto spec = _static_option_table->findAlias(alias_name_);
+        if (spec == nullptr) {
+            type_.reset();
+            return {};
+        }
+        type_ = spec->type != OptionType::NULLITY ? spec->type : OptionType();
+        return spec->name;
+    }
+    if (_frozen_option_table.has_value()) {
+        const auto entry = _frozen_option_table->findAlias(alias_name_);
+        if (!entry.has_value()) {
+            type_.reset();
+            return {};
+        }
+        type_ = entry->registered
+                    ? std::optional(entry->type != OptionType::NULLITY ? entry->type : OptionType())
+                    : std::nullopt;
+        return entry->name;
+    }
+    const auto option_name = _alias.findOptionName(alias_name_);
+    if (option_name == nullptr) {
+        type_.reset();
+        return {};
+    }
+    type_ = _findOptionType(*option_name);
+    return *option_name;
+}
+
+std::optional<net_ln3::cpp_lib::ArgumentParser::OptionValue>
+net_ln3::cpp_lib::ArgumentParser::Schema::_convertOptionValue(const std::string_view value_, const OptionType type_,
+                                                              const _ParseState& state_,
+                                                              ParseResult& result_) const {
+    using sv = ParseUtil::StringValidator;
+    if (_lazy_conversion) {
+        // 検証のみを行い、変換は値を取得する際に行う。
+        switch (type_) {
+        case OptionType::SIGNED:
+            if (!sv::isValidSigned(value_)) { return std::nullopt; }
+            return result_._makeLazyValue(value_, type_, state_.storage);
+        case OptionType::UNSIGNED:
+            if (!sv::isValidUnsigned(value_)) { return std::nullopt; }
+            return result_._makeLazyValue(value_, type_, state_.storage);
+        case OptionType::LONG_DOUBLE:
+            if (!sv::isValidLongDouble(value_)) { return std::nullopt; }
+            return result_._makeLazyValue(value_, type_, state_.storage);
+        default:
+            break;
+        }
+    }
+    switch (type_) {
+    case OptionType::STRING:
+        return result_._makeStringValue(value_, state_.storage);
+    case OptionType::SIGNED:
+        if (const auto v = sv::parseSigned(value_); v.has_value()) { return OptionValue::createInstance(*v); }
         break;
     case OptionType::UNSIGNED:
-        ov = OptionValue::createInstance(std::stoull(value_));
+        if (const auto v = sv::parseUnsigned(value_); v.has_value()) { return OptionValue::createInstance(*v); }
         break;
     case OptionType::LONG_DOUBLE:
-        ov = OptionValue::createInstance(std::stod(value_));
+        if (const auto v = sv::parseLongDouble(value_); v.has_value()) { return OptionValue::createInstance(*v); }
         break;
     case OptionType::BOOLEAN:
-        ov = OptionValue::createInstance(value_ == "true");
-        break;
-    case OptionType::NULLITY:
-        ov = OptionValue();
+        if (const auto v = sv::parseBoolean(value_); v.has_value()) { return OptionValue::createInstance(*v); }
         break;
     default:
         break;
     }
-    return ov;
+    return std::nullopt;
+}
+
+net_ln3::cpp_lib::ArgumentParser::ArgumentParser() : ArgumentParser(nullptr) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::ArgumentParser(std::pmr::memory_resource* resource_)
+    : ArgumentParser(_getDefaultSchema(), resource_) {
+}
+
+namespace {
+    /**
+     * @brief サブコマンドの名称を、空白で区切られた単語に分割します。
+     */
+    std::vector<std::string_view> splitCommandWords(const std::string_view path_) {
+        std::vector<std::string_view> words;
+        for (size_t begin = 0; begin < path_.size();) {
+            const size_t end = std::min(path_.find(' ', begin), path_.size());
+            if (end != begin) { words.push_back(path_.substr(begin, end - begin)); }
+            begin = end + 1;
+        }
+        return words;
+    }
+}
+
+net_ln3::cpp_lib::ArgumentParser::CommandTree::CommandTree(std::shared_ptr<const Schema> global_,
+                                                           const std::span<const Command> commands_)
+    : _global(global_ != nullptr ? std::move(global_) : _getDefaultSchema()) {
+    // キーは名称の各単語を_SEPARATORで連結した文字列。
+    std::vector<std::pair<std::string, int32_t>> keys;
+    const auto add_command = [&](std::string key_, std::string path_, const std::shared_ptr<const Schema>& schema_) {
+        std::shared_ptr<const Schema> schema;
+        if (schema_ != nullptr) {
+            auto copied = std::make_shared<Schema>(*schema_);
+            copied->_fallback_schema = _global;
+            schema = std::move(copied);
+        }
+        keys.emplace_back(std::move(key_), static_cast<int32_t>(_commands.size()));
+        _commands.push_back({std::move(path_), std::move(schema)});
+    };
+    // 同じ名称が複数回定義されている場合は、最初の定義を使用する。
+    std::unordered_set<std::string> seen;
+    for (const auto& command : commands_) {
+        std::string key;
+        std::string path;
+        for (const auto word : splitCommandWords(command.path)) {
+            if (!key.empty()) {
+                key += _SEPARATOR;
+                path += ' ';
+            }
+            key += word;
+            path += word;
+        }
+        if (key.empty() || !seen.insert(key).second) { continue; }
+        add_command(std::move(key), std::move(path), command.schema);
+    }
+    // 親のサブコマンドが定義されていない場合は、設定を持たないサブコマンドとして追加する。
+    for (size_t i = 0, size = keys.size(); i < size; i++) {
+        for (auto pos = keys[i].first.rfind(_SEPARATOR); pos != std::string::npos;
+             pos = keys[i].first.rfind(_SEPARATOR, pos - 1)) {
+            auto key = keys[i].first.substr(0, pos);
+            if (!seen.insert(key).second) { break; }
+            auto path = key;
+            std::ranges::replace(path, _SEPARATOR, ' ');
+            add_command(std::move(key), std::move(path), nullptr);
+        }
+    }
+    std::ranges::sort(keys);
+    _nodes.reserve(keys.size() + 1);
+    _build(keys, 0);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::CommandTree::parse(const std::vector<std::string>& args_,
+                                                          ParseResult& result_) const {
+    _parse(args_, ParseResult::_StringStorage::COPY, result_);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::CommandTree::parse(const int argc_, const char* const argv_[],
+                                                          ParseResult& result_) const {
+    _parse(std::span(argv_, argc_), ParseResult::_StringStorage::COPY, result_);
 }
 
-const std::regex net_ln3::cpp_lib::ArgumentParser::_option_name_pattern{"--.+"};
-const std::regex net_ln3::cpp_lib::ArgumentParser::_alias_name_pattern{"-.+"};
-const std::regex net_ln3::cpp_lib::ArgumentParser::_extract_option_name_pattern{"^--"};
-const std::regex net_ln3::cpp_lib::ArgumentParser::_extract_alias_name_pattern{"^-"};
+void net_ln3::cpp_lib::ArgumentParser::CommandTree::parseView(const std::span<const std::string_view> args_,
+                                                              ParseResult& result_) const {
+    _parse(args_, ParseResult::_StringStorage::REFERENCE, result_);
+}
+
+const net_ln3::cpp_lib::ArgumentParser::Schema* net_ln3::cpp_lib::ArgumentParser::CommandTree::findSchema(
+    const std::string_view path_) const {
+    const Schema* schema = _global.get();
+    uint32_t node = 0;
+    for (const auto word : splitCommandWords(path_)) {
+        const auto child = _findChild(node, word);
+        if (!child.has_value()) { return nullptr; }
+        node = *child;
+        if (const auto& selected = _commands[_nodes[node].command].schema; selected != nullptr) {
+            schema = selected.get();
+        }
+    }
+    return schema;
+}
+
+uint32_t net_ln3::cpp_lib::ArgumentParser::CommandTree::_build(
+    const std::span<const std::pair<std::string, int32_t>> keys_, const size_t depth_) {
+    const auto index = static_cast<uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+    auto rest = keys_;
+    // キーは昇順のため、この節点で終わるキーは先頭にある。
+    if (!rest.empty() && rest.front().first.size() == depth_) {
+        _nodes[index].command = rest.front().second;
+        rest = rest.subspan(1);
+    }
+    // 子への辺を連続して配置するため、部分木を構築する前に辺を確保する。
+    std::vector<std::span<const std::pair<std::string, int32_t>>> groups;
+    while (!rest.empty()) {
+        const auto label = rest.front().first[depth_];
+        size_t count = 1;
+        while (count < rest.size() && rest[count].first[depth_] == label) { count++; }
+        groups.push_back(rest.first(count));
+        rest = rest.subspan(count);
+    }
+    _nodes[index].first_edge = static_cast<uint32_t>(_edges.size());
+    _nodes[index].edge_count = static_cast<uint32_t>(groups.size());
+    for (const auto& group : groups) { _edges.push_back({group.front().first[depth_], 0}); }
+    for (size_t i = 0; i < groups.size(); i++) {
+        const auto target = _build(groups[i], depth_ + 1);
+        _edges[_nodes[index].first_edge + i].target = target;
+    }
+    return index;
+}
+
+std::optional<uint32_t> net_ln3::cpp_lib::ArgumentParser::CommandTree::_follow(const uint32_t node_,
+                                                                              const char label_) const {
+    // std::stringの比較と同じく、符号なしの値で比較する。
+    const auto edges = std::span(_edges).subspan(_nodes[node_].first_edge, _nodes[node_].edge_count);
+    const auto found = std::ranges::lower_bound(edges, static_cast<unsigned char>(label_), {},
+                                                [](const _TrieEdge& edge_) {
+                                                    return static_cast<unsigned char>(edge_.label);
+                                                });
+    if (found == edges.end() || found->label != label_) { return std::nullopt; }
+    return found->target;
+}
+
+std::optional<uint32_t> net_ln3::cpp_lib::ArgumentParser::CommandTree::_findChild(uint32_t node_,
+                                                                                 const std::string_view name_) const {
+    if (name_.empty()) { return std::nullopt; }
+    // 根以外では、名称の区切りをたどってから照合する。
+    if (node_ != 0) {
+        const auto next = _follow(node_, _SEPARATOR);
+        if (!next.has_value()) { return std::nullopt; }
+        node_ = *next;
+    }
+    for (const auto c : name_) {
+        if (c == _SEPARATOR) { return std::nullopt; }
+        const auto next = _follow(node_, c);
+        if (!next.has_value()) { return std::nullopt; }
+        node_ = *next;
+    }
+    if (_nodes[node_].command < 0) { return std::nullopt; }
+    return node_;
+}
+
+template <class R>
+void net_ln3::cpp_lib::ArgumentParser::CommandTree::_parse(const R& args_, const ParseResult::_StringStorage storage_,
+                                                           ParseResult& result_) const {
+    const Schema* schema = _global.get();
+    uint32_t node = 0;
+    // オプションでもオプションの値でもない引数が、サブコマンドに一致する間は選択を続ける。
+    bool routing = true;
+    Schema::_ParseState state;
+    state.storage = storage_;
+    for (const auto& arg : args_) {
+        const std::string_view token(arg);
+        if (routing && !state.option_value_flag && classifyToken(token).kind == TokenKind::ARGUMENT) {
+            if (const auto child = _findChild(node, token); child.has_value()) {
+                node = *child;
+                if (const auto& selected = _commands[_nodes[node].command].schema; selected != nullptr) {
+                    schema = selected.get();
+                }
+                result_._token_count++;
+                continue;
+            }
+            routing = false;
+        }
+        schema->_parseArgument(token, state, result_);
+    }
+    if (node != 0) { result_._command = result_._copyString(_commands[_nodes[node].command].path); }
+    schema->_applyFallbackSources(result_);
+}
+
+net_ln3::cpp_lib::ArgumentParser::ArgumentParser(OptionNames type_, std::pmr::memory_resource* resource_)
+    : ArgumentParser(std::move(type_), {}, resource_) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::ArgumentParser(OptionNames type_,
+                                                 OptionAlias alias_,
+                                                 std::pmr::memory_resource* resource_)
+    : ArgumentParser(std::make_shared<const Schema>(std::move(type_), std::move(alias_)), resource_) {
+}
+
+net_ln3::cpp_lib::ArgumentParser::ArgumentParser(std::shared_ptr<const Schema> schema_,
+                                                 std::pmr::memory_resource* resource_)
+    : _schema(std::move(schema_)), _result(resource_) {
+}
+
+const std::shared_ptr<const net_ln3::cpp_lib::ArgumentParser::Schema>&
+net_ln3::cpp_lib::ArgumentParser::_getDefaultSchema() {
+    static const auto schema = std::make_shared<const Schema>();
+    return schema;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::parse(const int argc_, char** argv_) { _schema->parse(argc_, argv_, _result); }
+
+void net_ln3::cpp_lib::ArgumentParser::parse(const std::vector<std::string>& args_) { _schema->parse(args_, _result); }
+
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::tryParse(
+    const int argc_, const char* const argv_[]) noexcept { return _schema->tryParse(argc_, argv_, _result); }
+
+net_ln3::cpp_lib::ArgumentParser::ErrorCode net_ln3::cpp_lib::ArgumentParser::tryParse(
+    const std::span<const std::string_view> args_) noexcept { return _schema->tryParse(args_, _result); }
+
+void net_ln3::cpp_lib::ArgumentParser::parseCommandLine(const std::string_view command_) {
+    _schema->parseCommandLine(command_, _result);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::parseCommandLineView(const std::string_view command_) {
+    _schema->parseCommandLineView(command_, _result);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::feed(const std::string_view token_) { _schema->feed(token_, _result); }
+
+void net_ln3::cpp_lib::ArgumentParser::finish() { _schema->finish(_result); }
+
+void net_ln3::cpp_lib::ArgumentParser::freeze() {
+    // 設定は共有されているため、表を追加した設定を新たに作成する。
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->freeze();
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::enableResponseFiles(const size_t max_depth_) {
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->enableResponseFiles(max_depth_);
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::enableLazyConversion() {
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->enableLazyConversion();
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::enableEnvironment(std::string prefix_) {
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->enableEnvironment(std::move(prefix_));
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::enableConfigFile(std::filesystem::path path_) {
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->enableConfigFile(std::move(path_));
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::enableAbbreviation() {
+    auto schema = std::make_shared<Schema>(*_schema);
+    schema->enableAbbreviation();
+    _schema = std::move(schema);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::reset() { _result.reset(); }
+
+const std::shared_ptr<const net_ln3::cpp_lib::ArgumentParser::Schema>&
+net_ln3::cpp_lib::ArgumentParser::getSchema() const { return _schema; }
+
+const net_ln3::cpp_lib::ArgumentParser::ParseResult& net_ln3::cpp_lib::ArgumentParser::getResult() const {
+    return _result;
+}
+
+void net_ln3::cpp_lib::ArgumentParser::parseView(const int argc_, const char* const argv_[]) {
+    _schema->parseView(argc_, argv_, _result);
+}
+
+void net_ln3::cpp_lib::ArgumentParser::parseView(const std::span<const std::string_view> args_) {
+    _schema->parseView(args_, _result);
+}
+
+const std::vector<std::string>& net_ln3::cpp_lib::ArgumentParser::getArgs() const { return _result.getArgs(); }
+
+std::span<const std::string_view> net_ln3::cpp_lib::ArgumentParser::getArgViews() const {
+    return _result.getArgViews();
+}
+
+std::string net_ln3::cpp_lib::ArgumentParser::getArg(const size_t i_) const { return _result.getArg(i_); }
+
+net_ln3::cpp_lib::ArgumentParser::OptionValue net_ln3::cpp_lib::ArgumentParser::getOption(
+    const std::string_view option_name_, const OptionValue& default_) const {
+    return _result.getOption(option_name_, default_);
+}
+
+const net_ln3::cpp_lib::ArgumentParser::OptionValue* net_ln3::cpp_lib::ArgumentParser::findOption(
+    const std::string_view option_name_) const noexcept {
+    return _result.findOption(option_name_);
+}
+
+std::span<const std::string_view> net_ln3::cpp_lib::ArgumentParser::getStringList(
+    const std::string_view option_name_) const noexcept {
+    return _result.getStringList(option_name_);
+}
+
+std::span<const long long> net_ln3::cpp_lib::ArgumentParser::getSignedList(
+    const std::string_view option_name_) const noexcept {
+    return _result.getSignedList(option_name_);
+}
+
+std::span<const unsigned long long> net_ln3::cpp_lib::ArgumentParser::getUnsignedList(
+    const std::string_view option_name_) const noexcept {
+    return _result.getUnsignedList(option_name_);
+}
+
+std::span<const long double> net_ln3::cpp_lib::ArgumentParser::getLongDoubleList(
+    const std::string_view option_name_) const noexcept {
+    return _result.getLongDoubleList(option_name_);
+}
+
+bool net_ln3::cpp_lib::ArgumentParser::isExistOption(const std::string_view key_) const {
+    return _result.isExistOption(key_);
+}
+
+const std::unordered_map<std::string, std::vector<std::string>>&
+net_ln3::cpp_lib::ArgumentParser::getInvalidOptions() const { return _result.getInvalidOptions(); }
+
+const std::unordered_map<std::string, std::vector<std::pair<std::string,
+                                                            net_ln3::cpp_lib::ArgumentParser::OptionType>>>&
+net_ln3::cpp_lib::ArgumentParser::getInvalidOptionTypes() const { return _result.getInvalidOptionTypes(); }
+
+const std::unordered_map<std::string, std::vector<std::string>>&
+net_ln3::cpp_lib::ArgumentParser::getInvalidAlias() const { return _result.getInvalidAlias(); }
+
+net_ln3::cpp_lib::ArgumentParser::TokenClass net_ln3::cpp_lib::ArgumentParser::classifyToken(
+    const std::string_view arg_) noexcept {
+    // 接頭辞以降に改行文字を含む場合、正規表現の`.`に一致しないため引数として扱う。
+    if (arg_.size() < 2 || arg_.front() != '-' || arg_.find_first_of("\r\n", 1) != std::string_view::npos) {
+        return {TokenKind::ARGUMENT, 0};
+    }
+    if (arg_.size() >= 3 && arg_[1] == '-') { return {TokenKind::OPTION, 2}; }
+    return {TokenKind::ALIAS, 1};
+}
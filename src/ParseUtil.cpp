@@ -22,6 +22,19 @@
 
 
 #include <net_ln3/cpp_lib/ParseUtil.h>
+#include <net_ln3/cpp_lib/multi_platform_util.h>
+#include <algorithm>
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#endif
 
 namespace net_ln3::cpp_lib {
     template <class T>
@@ -35,7 +48,8 @@ namespace net_ln3::cpp_lib {
             }
             return std::vector<T>(array.begin(), array.begin() + end + 1); // 最初からendまでの文字列
         }
-        throw ParseUtilOutOfRange("[ParseUtil::slice()] Error: invalid argument. beg or end is out of range.");
+        multi_platform::raise(
+            ParseUtilOutOfRange("[ParseUtil::slice()] Error: invalid argument. beg or end is out of range."));
     }
 
     std::vector<char> ParseUtil::toArray(std::string str) { return {str.begin(), str.end()}; }
@@ -43,35 +57,31 @@ namespace net_ln3::cpp_lib {
     std::string ParseUtil::toString(std::vector<char> array) { return {array.begin(), array.end()}; }
 
     std::string ParseUtil::slice(std::string str, size_t beg, size_t end) {
-        try { return toString(slice(toArray(std::move(str)), beg, end)); }
-        catch (std::exception& e) { throw; }
+        return toString(slice(toArray(std::move(str)), beg, end));
     }
 
     std::vector<std::string> ParseUtil::split(const std::string& str, const std::string& delim) {
-        try {
-            if (delim.empty()) {
-                auto tmp_result = toArray(str);
-                std::vector<std::string> result{};
-                for (const auto& i : tmp_result) {
-                    std::string w;
-                    w.push_back(i);
-                    result.emplace_back(w);
-                }
-                return result;
-            }
-            std::string work = str;
-            std::vector<std::string> result;
-            size_t pos = work.find(delim);
-            while (pos != std::string::npos) {
-                result.emplace_back(slice(work, 0, pos + delim.length() - 1));
-                work.erase(0, result.back().length());
-                result.back() = std::regex_replace(result.back(), std::regex(delim), "");
-                pos = work.find(delim);
-            }
-            result.emplace_back(work);
+        if (delim.empty()) {
+            auto tmp_result = toArray(str);
+            std::vector<std::string> result{};
+            for (const auto& i : tmp_result) {
+                std::string w;
+                w.push_back(i);
+                result.emplace_back(w);
+            }
             return result;
         }
-        catch (std::exception& e) { throw; }
+        std::string work = str;
+        std::vector<std::string> result;
+        size_t pos = work.find(delim);
+        while (pos != std::string::npos) {
+            result.emplace_back(slice(work, 0, pos + delim.length() - 1));
+            work.erase(0, result.back().length());
+            result.back() = std::regex_replace(result.back(), std::regex(delim), "");
+            pos = work.find(delim);
+        }
+        result.emplace_back(work);
+        return result;
     }
 
     std::string ParseUtil::appendAll(const std::vector<std::string>& input, const std::string& glue) {
@@ -81,54 +91,425 @@ namespace net_ln3::cpp_lib {
         return str;
     }
 
-    bool ParseUtil::StringValidator::isValidSigned(const std::string& str_) {
-        if (!std::regex_match(str_, _signedPattern)) { return false; }
-        return _validateHelper(str_, [](const std::string& s_) {
-            static_cast<void>(std::stoll(s_));
-            return true;
-        });
+    namespace {
+        bool isDigit(const char c_) { return c_ >= '0' && c_ <= '9'; }
+
+        /**
+         * @brief 整数部を読み飛ばします。`0`以外は先頭に`0`を置けません。
+         * @return 整数部の終了位置。形式が不正な場合はnpos
+         */
+        size_t skipInteger(const std::string_view str_, size_t pos_) {
+            if (pos_ >= str_.size() || !isDigit(str_[pos_])) { return std::string_view::npos; }
+            if (str_[pos_++] == '0') { return pos_; }
+            while (pos_ < str_.size() && isDigit(str_[pos_])) { pos_++; }
+            return pos_;
+        }
+
+        /**
+         * @brief 浮動小数点数の形式であるかを確認します。
+         * @param max_exponent_digits_ 指数部の最大の桁数
+         * @return 形式が正しい場合は、値の10進の桁数の上限(文字列長と指数部の絶対値の和)。不正な場合はnullopt
+         */
+        std::optional<size_t> scanFloating(const std::string_view str_, const size_t max_exponent_digits_) {
+            size_t pos = !str_.empty() && (str_[0] == '+' || str_[0] == '-') ? 1 : 0;
+            pos = skipInteger(str_, pos);
+            if (pos == std::string_view::npos) { return std::nullopt; }
+            if (pos < str_.size() && str_[pos] == '.') {
+                const size_t begin = ++pos;
+                while (pos < str_.size() && isDigit(str_[pos])) { pos++; }
+                if (pos == begin) { return std::nullopt; }
+            }
+            size_t exponent = 0;
+            if (pos < str_.size() && str_[pos] == 'e') {
+                if (++pos < str_.size() && (str_[pos] == '+' || str_[pos] == '-')) { pos++; }
+                const size_t begin = pos;
+                pos = skipInteger(str_, pos);
+                if (pos == std::string_view::npos || pos - begin > max_exponent_digits_) { return std::nullopt; }
+                for (size_t i = begin; i < pos; i++) { exponent = exponent * 10 + static_cast<size_t>(str_[i] - '0'); }
+            }
+            if (pos != str_.size()) { return std::nullopt; }
+            return str_.size() + exponent;
+        }
+
+        /**
+         * @brief 形式を確認済みの文字列を、std::from_charsで変換します。
+         * @details std::from_charsは先頭の`+`を受け付けないため、取り除いてから変換します。
+         * @details 従来のstd::stod()などと同様に、0以外の非正規化数となる値はアンダーフローとして受け付けません。
+         */
+        template <class T>
+        std::optional<T> fromChars(std::string_view str_) {
+            if (!str_.empty() && str_[0] == '+') { str_.remove_prefix(1); }
+            T value{};
+            const auto [ptr, ec] = std::from_chars(str_.data(), str_.data() + str_.size(), value);
+            if (ec != std::errc() || ptr != str_.data() + str_.size()) { return std::nullopt; }
+            if constexpr (std::is_floating_point_v<T>) {
+                if (value != 0 && (value < 0 ? -value : value) < std::numeric_limits<T>::min()) { return std::nullopt; }
+            }
+            return value;
+        }
+
+        template <class T>
+        std::optional<T> parseFloating(const std::string_view str_, const size_t max_exponent_digits_) {
+            if (!scanFloating(str_, max_exponent_digits_).has_value()) { return std::nullopt; }
+            return fromChars<T>(str_);
+        }
+
+        /**
+         * @brief 変換を行わずに、浮動小数点数として有効な文字列であるかを確認します。
+         * @details 桁数の上限が型の指数の範囲に十分収まる場合は、オーバーフローもアンダーフローも起こり得ないため、
+         * std::from_charsによる変換を省略します。
+         */
+        template <class T>
+        bool isValidFloating(const std::string_view str_, const size_t max_exponent_digits_) {
+            constexpr size_t safe_digits = static_cast<size_t>(
+                std::min(std::numeric_limits<T>::max_exponent10, -std::numeric_limits<T>::min_exponent10) - 1);
+            const auto digits = scanFloating(str_, max_exponent_digits_);
+            if (!digits.has_value()) { return false; }
+            return *digits <= safe_digits || fromChars<T>(str_).has_value();
+        }
+
+        /**
+         * @brief 変換を行わずに、整数として有効な文字列であるかを確認します。
+         * @details 桁数が型の10進の桁数(std::numeric_limits::digits10)以下であれば範囲内であるため、
+         * std::from_charsによる変換を省略します。
+         */
+        template <class T>
+        bool isValidInteger(const std::string_view str_, const size_t begin_) {
+            if (skipInteger(str_, begin_) != str_.size()) { return false; }
+            return str_.size() - begin_ <= static_cast<size_t>(std::numeric_limits<T>::digits10)
+                || fromChars<T>(str_).has_value();
+        }
+
+        bool equalsIgnoreCase(const std::string_view str_, const std::string_view lower_) {
+            return std::ranges::equal(str_, lower_, [](const char a_, const char b_) {
+                return (a_ >= 'A' && a_ <= 'Z' ? static_cast<char>(a_ - 'A' + 'a') : a_) == b_;
+            });
+        }
     }
 
-    bool ParseUtil::StringValidator::isValidUnsigned(const std::string& str_) {
-        if (!std::regex_match(str_, _unsignedPattern)) { return false; }
-        return _validateHelper(str_, [](const std::string& s_) {
-            static_cast<void>(std::stoull(s_));
-            return true;
-        });
+    bool ParseUtil::StringValidator::isValidSigned(const std::string_view str_) noexcept {
+        return isValidInteger<long long>(str_, !str_.empty() && (str_[0] == '+' || str_[0] == '-') ? 1 : 0);
     }
 
-    bool ParseUtil::StringValidator::isValidLongDouble(const std::string& str_) {
-        if (!std::regex_match(str_, _longDoublePattern)) { return false; }
-        return _validateHelper(str_, [](const std::string& s_) {
-            static_cast<void>(std::stold(s_));
+    bool ParseUtil::StringValidator::isValidUnsigned(const std::string_view str_) noexcept {
+        return isValidInteger<unsigned long long>(str_, !str_.empty() && str_[0] == '+' ? 1 : 0);
+    }
+
+    bool ParseUtil::StringValidator::isValidLongDouble(const std::string_view str_) noexcept {
+        return isValidFloating<long double>(str_, 4);
+    }
+
+    bool ParseUtil::StringValidator::isValidDouble(const std::string_view str_) noexcept {
+        return isValidFloating<double>(str_, 3);
+    }
+
+    bool ParseUtil::StringValidator::isValidBoolean(const std::string_view str_) noexcept {
+        return parseBoolean(str_).has_value();
+    }
+
+    std::optional<long long> ParseUtil::StringValidator::parseSigned(const std::string_view str_) noexcept {
+        const size_t begin = !str_.empty() && (str_[0] == '+' || str_[0] == '-') ? 1 : 0;
+        if (skipInteger(str_, begin) != str_.size()) { return std::nullopt; }
+        return fromChars<long long>(str_);
+    }
+
+    std::optional<unsigned long long> ParseUtil::StringValidator::parseUnsigned(const std::string_view str_) noexcept {
+        const size_t begin = !str_.empty() && str_[0] == '+' ? 1 : 0;
+        if (skipInteger(str_, begin) != str_.size()) { return std::nullopt; }
+        return fromChars<unsigned long long>(str_);
+    }
+
+    std::optional<long double> ParseUtil::StringValidator::parseLongDouble(const std::string_view str_) noexcept {
+        return parseFloating<long double>(str_, 4);
+    }
+
+    std::optional<double> ParseUtil::StringValidator::parseDouble(const std::string_view str_) noexcept {
+        return parseFloating<double>(str_, 3);
+    }
+
+    std::optional<bool> ParseUtil::StringValidator::parseBoolean(const std::string_view str_) noexcept {
+        if (equalsIgnoreCase(str_, "true")) { return true; }
+        if (equalsIgnoreCase(str_, "false")) { return false; }
+        return std::nullopt;
+    }
+
+    namespace {
+#if defined(__AVX2__)
+        /// 1回に判定するバイト数
+        constexpr size_t array_block_size = 32;
+
+        /// blockに含まれる`,`の数を数えます。
+        int countCommas(const char* block_) {
+            const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block_));
+            const __m256i commas = _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(','));
+            return std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(commas)));
+        }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        /// 1回に判定するバイト数
+        constexpr size_t array_block_size = 16;
+
+        /// blockに含まれる`,`の数を数えます。
+        int countCommas(const char* block_) {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block_));
+            const __m128i commas = _mm_cmpeq_epi8(chars, _mm_set1_epi8(','));
+            return std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(commas)));
+        }
+#endif
+
+        /// 8バイト(リトルエンディアンで読み込んだ値)がすべて数字であるかを判定します。
+        bool isEightDigits(const uint64_t chunk_) {
+            return ((chunk_ & 0xF0F0F0F0F0F0F0F0)
+                    | (((chunk_ + 0x0606060606060606) & 0xF0F0F0F0F0F0F0F0) >> 4)) == 0x3333333333333333;
+        }
+
+        /**
+         * @brief 8桁の数字(リトルエンディアンで読み込んだ値)を変換します。
+         * @details 隣り合う桁を2桁、4桁、8桁の順にまとめることで、乗算3回で変換します。
+         */
+        uint64_t parseEightDigits(uint64_t chunk_) {
+            chunk_ = (chunk_ & 0x0F0F0F0F0F0F0F0F) * 2561 >> 8;
+            chunk_ = (chunk_ & 0x00FF00FF00FF00FF) * 6553601 >> 16;
+            return (chunk_ & 0x0000FFFF0000FFFF) * 42949672960001 >> 32;
+        }
+
+        /**
+         * @brief 19桁以下の数字の列を変換します。
+         * @return 数字以外の文字を含む場合はnullopt
+         */
+        std::optional<uint64_t> parseDigits(std::string_view digits_) {
+            uint64_t value = 0;
+            if constexpr (std::endian::native == std::endian::little) {
+                for (; digits_.size() >= 8; digits_.remove_prefix(8)) {
+                    uint64_t chunk;
+                    std::memcpy(&chunk, digits_.data(), sizeof(chunk));
+                    if (!isEightDigits(chunk)) { return std::nullopt; }
+                    value = value * 100000000 + parseEightDigits(chunk);
+                }
+            }
+            for (const char c : digits_) {
+                if (!isDigit(c)) { return std::nullopt; }
+                value = value * 10 + static_cast<uint64_t>(c - '0');
+            }
+            return value;
+        }
+
+        /**
+         * @brief 配列の要素を1つ整数に変換します。
+         * @details 桁数が型の10進の桁数(std::numeric_limits::digits10)以下であれば範囲内であるため、
+         * parseDigits()で変換します。それ以外の場合はstd::from_charsで変換します。
+         */
+        template <class T>
+        bool parseIntegerElement(const std::string_view element_, T& value_) {
+            const bool negative = !element_.empty() && element_[0] == '-';
+            if (std::is_unsigned_v<T> && negative) { return false; }
+            const size_t begin = negative || (!element_.empty() && element_[0] == '+') ? 1 : 0;
+            const std::string_view digits = element_.substr(begin);
+            if (digits.empty() || (digits[0] == '0' && digits.size() > 1)) { return false; }
+            if (digits.size() <= static_cast<size_t>(std::numeric_limits<T>::digits10)) {
+                const auto value = parseDigits(digits);
+                if (!value.has_value()) { return false; }
+                value_ = negative ? static_cast<T>(0 - *value) : static_cast<T>(*value);
+                return true;
+            }
+            if (skipInteger(element_, begin) != element_.size()) { return false; }
+            const auto value = fromChars<T>(element_);
+            if (!value.has_value()) { return false; }
+            value_ = *value;
             return true;
-        });
+        }
+
+        /**
+         * @brief カンマ区切りの配列を、要素ごとにparse_element_で変換します。
+         * @return すべての要素を変換できた場合はARRAY_VALID、それ以外の場合は最初の不正な要素の番号
+         */
+        template <class T, class F>
+        size_t parseArray(const std::string_view str_, const std::span<T> values_, F parse_element_) {
+            size_t index = 0;
+            size_t begin = 0;
+            while (true) {
+                const size_t end = std::min(str_.find(',', begin), str_.size());
+                if (index >= values_.size() || !parse_element_(str_.substr(begin, end - begin), values_[index])) {
+                    return index;
+                }
+                index++;
+                if (end == str_.size()) { break; }
+                begin = end + 1;
+            }
+            return index == values_.size() ? ParseUtil::StringValidator::ARRAY_VALID : index;
+        }
+    }
+
+    size_t ParseUtil::StringValidator::countArrayElements(const std::string_view str_) noexcept {
+        size_t count = 1;
+        size_t position = 0;
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        for (; position + array_block_size <= str_.size(); position += array_block_size) {
+            count += static_cast<size_t>(countCommas(str_.data() + position));
+        }
+#endif
+        count += static_cast<size_t>(std::count(str_.begin() + static_cast<std::ptrdiff_t>(position), str_.end(), ','));
+        return count;
+    }
+
+    size_t ParseUtil::StringValidator::parseSignedArray(const std::string_view str_,
+                                                        const std::span<long long> values_) noexcept {
+        return parseArray(str_, values_, parseIntegerElement<long long>);
     }
 
-    bool ParseUtil::StringValidator::isValidDouble(const std::string& str_) {
-        if (!std::regex_match(str_, _doublePattern)) { return false; }
-        return _validateHelper(str_, [](const std::string& s_) {
-            static_cast<void>(std::stod(s_));
+    size_t ParseUtil::StringValidator::parseUnsignedArray(const std::string_view str_,
+                                                          const std::span<unsigned long long> values_) noexcept {
+        return parseArray(str_, values_, parseIntegerElement<unsigned long long>);
+    }
+
+    size_t ParseUtil::StringValidator::parseLongDoubleArray(const std::string_view str_,
+                                                            const std::span<long double> values_) noexcept {
+        return parseArray(str_, values_, [](const std::string_view element_, long double& value_) {
+            const auto value = parseLongDouble(element_);
+            if (!value.has_value()) { return false; }
+            value_ = *value;
             return true;
         });
     }
 
-    bool ParseUtil::StringValidator::isValidBoolean(const std::string& str_) {
-        return std::regex_match(str_, _booleanPattern);
+    namespace {
+        bool isShellWhitespace(const char c_) { return c_ == ' ' || (c_ >= '\t' && c_ <= '\r'); }
+
+        bool isShellSpecial(const char c_) { return isShellWhitespace(c_) || c_ == '\'' || c_ == '"' || c_ == '\\'; }
+
+#if defined(__AVX2__)
+        /// 1回に判定するバイト数
+        constexpr size_t shell_block_size = 32;
+
+        /**
+         * @brief blockの各バイトが、空白文字・引用符・`\`であるかを判定します。
+         * @return 該当するバイトのビットが立ったマスク
+         */
+        uint32_t findShellSpecialMask(const char* block_) {
+            const __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block_));
+            // `\t`から`\r`までを、符号付きで最小の範囲(-128から-124)に移して1回の比較で判定する。
+            const __m256i shifted = _mm256_add_epi8(chars, _mm256_set1_epi8(static_cast<char>(0x80 - '\t')));
+            __m256i special = _mm256_cmpgt_epi8(_mm256_set1_epi8(static_cast<char>(0x80 + ('\r' - '\t') + 1)), shifted);
+            special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8(' ')));
+            special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\'')));
+            special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('"')));
+            special = _mm256_or_si256(special, _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('\\')));
+            return static_cast<uint32_t>(_mm256_movemask_epi8(special));
+        }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        /// 1回に判定するバイト数
+        constexpr size_t shell_block_size = 16;
+
+        /**
+         * @brief blockの各バイトが、空白文字・引用符・`\`であるかを判定します。
+         * @return 該当するバイトのビットが立ったマスク
+         */
+        uint32_t findShellSpecialMask(const char* block_) {
+            const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block_));
+            // `\t`から`\r`までを、符号付きで最小の範囲(-128から-124)に移して1回の比較で判定する。
+            const __m128i shifted = _mm_add_epi8(chars, _mm_set1_epi8(static_cast<char>(0x80 - '\t')));
+            __m128i special = _mm_cmplt_epi8(shifted, _mm_set1_epi8(static_cast<char>(0x80 + ('\r' - '\t') + 1)));
+            special = _mm_or_si128(special, _mm_cmpeq_epi8(chars, _mm_set1_epi8(' ')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi8(chars, _mm_set1_epi8('\'')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi8(chars, _mm_set1_epi8('"')));
+            special = _mm_or_si128(special, _mm_cmpeq_epi8(chars, _mm_set1_epi8('\\')));
+            return static_cast<uint32_t>(_mm_movemask_epi8(special));
+        }
+#endif
+
+        /**
+         * @brief position_以降で最初の空白文字・引用符・`\`の位置を検索します。
+         * @details SSE2またはAVX2が使用できる場合は、複数のバイトを一度に判定します。
+         * @return 見つかった位置。存在しない場合はinput_.size()
+         */
+        size_t findShellSpecial(const std::string_view input_, size_t position_) {
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+            for (; position_ + shell_block_size <= input_.size(); position_ += shell_block_size) {
+                if (const uint32_t mask = findShellSpecialMask(input_.data() + position_); mask != 0) {
+                    return position_ + static_cast<size_t>(std::countr_zero(mask));
+                }
+            }
+#endif
+            while (position_ < input_.size() && !isShellSpecial(input_[position_])) { position_++; }
+            return position_;
+        }
     }
 
-    bool ParseUtil::StringValidator::_validateHelper(const std::string& str_,
-                                                     const std::function<bool(const std::string&)>& _error_checker)
-        noexcept {
-        try { return _error_checker(str_); }
-        catch (std::exception& e) { return false; }
+    ParseUtil::ShellTokenizer::ShellTokenizer(const std::string_view input_) : _input(input_) {
     }
 
-    const std::regex ParseUtil::StringValidator::_signedPattern(R"([+\-]?(([1-9][0-9]{0,18})|0))");
-    const std::regex ParseUtil::StringValidator::_unsignedPattern(R"(\+?(([1-9][0-9]{0,19})|0))");
-    const std::regex ParseUtil::StringValidator::_longDoublePattern(
-        R"([+\-]?(([1-9][0-9]*)|(0))(\.[0-9]+)?(e[+-]?(([1-9][0-9]{0,3})|0))?)");
-    const std::regex ParseUtil::StringValidator::_doublePattern(
-        R"([+\-]?(([1-9][0-9]*)|(0))(\.[0-9]+)?(e[+-]?(([1-9][0-9]{0,2})|0))?)");
-    const std::regex ParseUtil::StringValidator::_booleanPattern(R"((true)|(false))", std::regex::icase);
+    bool ParseUtil::ShellTokenizer::next() {
+        while (true) {
+            while (_position < _input.size() && isShellWhitespace(_input[_position])) { _position++; }
+            if (_position == _input.size()) { return false; }
+            const size_t begin = _position;
+            _position = findShellSpecial(_input, begin);
+            // 引用符や`\`を含まない場合は、入力をそのまま参照する。
+            if (_position == _input.size() || isShellWhitespace(_input[_position])) {
+                _token = _input.substr(begin, _position - begin);
+                _unescaped = false;
+                return true;
+            }
+            // 行の継続のみの場合は空白として扱い、次の引数を探す。
+            if (_unescape(begin)) { return true; }
+        }
+    }
+
+    std::string_view ParseUtil::ShellTokenizer::getToken() const { return _token; }
+
+    bool ParseUtil::ShellTokenizer::isUnescaped() const { return _unescaped; }
+
+    bool ParseUtil::ShellTokenizer::_unescape(const size_t begin_) {
+        _buffer.assign(_input.substr(begin_, _position - begin_));
+        char quote = '\0';
+        // 空の引用符(`''`, `""`)は空の引数になるため、引用符を開いたかを記録する。
+        bool quoted = false;
+        while (_position < _input.size()) {
+            // 特別な意味を持たない文字は、まとめてコピーする。
+            const size_t end = quote == '\''
+                                   ? std::min(_input.find('\'', _position), _input.size())
+                                   : quote == '"'
+                                   ? std::min(_input.find_first_of("\"\\", _position), _input.size())
+                                   : findShellSpecial(_input, _position);
+            _buffer.append(_input.substr(_position, end - _position));
+            _position = end;
+            if (_position == _input.size()) { break; }
+            const char c = _input[_position];
+            if (quote == '\'') {
+                quote = '\0';
+                _position++;
+                continue;
+            }
+            if (c == '\\' && _position + 1 < _input.size()) {
+                const char escaped = _input[_position + 1];
+                _position += 2;
+                // 行の継続
+                if (escaped == '\n') { continue; }
+                if (escaped == '\r' && _position < _input.size() && _input[_position] == '\n') {
+                    _position++;
+                    continue;
+                }
+                // 二重引用符の内側では、POSIXシェルと同様に`"`, `\`, `$`, `` ` ``のみをエスケープする。
+                if (quote == '"' && escaped != '"' && escaped != '\\' && escaped != '$' && escaped != '`') {
+                    _buffer.push_back(c);
+                }
+                _buffer.push_back(escaped);
+                continue;
+            }
+            if (quote == '"') {
+                if (c == '"') { quote = '\0'; }
+                else { _buffer.push_back(c); }
+            }
+            else if (c == '\'' || c == '"') {
+                quote = c;
+                quoted = true;
+            }
+            else if (isShellWhitespace(c)) { break; }
+            else { _buffer.push_back(c); }
+            _position++;
+        }
+        if (_buffer.empty() && !quoted) { return false; }
+        _token = _buffer;
+        _unescaped = true;
+        return true;
+    }
 } // namespace net_ln3::cpp_lib
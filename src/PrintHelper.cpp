@@ -23,6 +23,7 @@
 #include <net_ln3/cpp_lib/PrintHelper.h>
 
 #include <algorithm>
+#include <charconv>
 #include <format>
 #include <sstream>
 #include <net_ln3/cpp_lib/multi_platform_util.h>
@@ -93,8 +94,8 @@ std::string net_ln3::cpp_lib::PrintHelper::Color(const std::string& input_, std:
             );
         }
         color_.erase(0, 1);
-        try { result_color = std::stoi(color_, nullptr, 16); }
-        catch (std::exception&) {
+        // 例外が無効な環境でも使用できるよう、std::stoiではなくstd::from_charsで変換する。
+        if (std::from_chars(color_.data(), color_.data() + color_.size(), result_color, 16).ec != std::errc()) {
             return std::format(
                 "[PrintHelper::Color] {}: 色コードが不正です。(\"{}\", {})",
                 Color("error", RED), input_, color_
@@ -102,7 +102,52 @@ unsigned long net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::_getCo
     return mode;
 }
 
+net_ln3::cpp_lib::multi_platform::MappedFile::MappedFile(const std::filesystem::path& path_) {
+    // ReSharper disable once CppLocalVariableMayBeConst
+    HANDLE file = CreateFileW(path_.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) { return; }
+    LARGE_INTEGER size;
+    if (GetFileType(file) != FILE_TYPE_DISK || !GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        return;
+    }
+    _size = static_cast<size_t>(size.QuadPart);
+    if (_size == 0) {
+        CloseHandle(file);
+        _is_open = true;
+        return;
+    }
+    // ビューはマッピングのハンドルを閉じた後も有効なため、ハンドルはここで閉じる。
+    // ReSharper disable once CppLocalVariableMayBeConst
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        _size = 0;
+        return;
+    }
+    _data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    CloseHandle(mapping);
+    if (_data == nullptr) {
+        _size = 0;
+        return;
+    }
+    _is_open = true;
+}
+
+net_ln3::cpp_lib::multi_platform::MappedFile::~MappedFile() {
+    if (_data != nullptr) { UnmapViewOfFile(_data); }
+}
+
+const char* const* net_ln3::cpp_lib::multi_platform::getEnvironment() noexcept { return _environ; }
+
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+extern char** environ;
 // DISABLE ALL FUNCTIONS
 
 net_ln3::cpp_lib::multi_platform::CodePageGuard::CodePageGuard() {}
@@ -123,8 +168,44 @@ bool net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::isExecuted() {
 
 unsigned long net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::_getConsoleMode() { return 0; }
 
+net_ln3::cpp_lib::multi_platform::MappedFile::MappedFile(const std::filesystem::path& path_) {
+    const int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) { return; }
+    struct stat status{};
+    if (fstat(fd, &status) != 0 || !S_ISREG(status.st_mode)) {
+        close(fd);
+        return;
+    }
+    _size = static_cast<size_t>(status.st_size);
+    if (_size == 0) {
+        close(fd);
+        _is_open = true;
+        return;
+    }
+    // マップはファイルディスクリプタを閉じた後も有効なため、ここで閉じる。
+    void* data = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) {
+        _size = 0;
+        return;
+    }
+    madvise(data, _size, MADV_SEQUENTIAL);
+    _data = static_cast<const char*>(data);
+    _is_open = true;
+}
+
+net_ln3::cpp_lib::multi_platform::MappedFile::~MappedFile() {
+    if (_data != nullptr) { munmap(const_cast<char*>(_data), _size); }
+}
+
+const char* const* net_ln3::cpp_lib::multi_platform::getEnvironment() noexcept { return environ; }
+
 #endif
 
+bool net_ln3::cpp_lib::multi_platform::MappedFile::isOpen() const { return _is_open; }
+
+std::string_view net_ln3::cpp_lib::multi_platform::MappedFile::getView() const { return {_data, _size}; }
+
 bool net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::_is_executed = false;
 bool net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::_enabled = false;
 bool net_ln3::cpp_lib::multi_platform::EnableAnsiEscapeSequence::_is_mode_obtained = false;
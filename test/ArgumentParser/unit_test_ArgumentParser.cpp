@@ -22,6 +22,12 @@
 
 
 #include <gtest/gtest.h>
+#include <array>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <memory_resource>
+#include <thread>
 #include <net_ln3/cpp_lib/ArgumentParser.h>
 #include <net_ln3/cpp_lib/ParseUtil.h>
 
@@ -122,3 +128,1006 @@ TEST(ArgumentParserParse, validMapAlias) {
         );
         ASSERT_EQ(parser.getInvalidAlias(), correctInvalidAliasArgs);
 }
+
+TEST(ArgumentParserParse, typedConversion) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                {
+                        {"signed", ArgumentParser::OptionType::SIGNED},
+                        {"unsigned", ArgumentParser::OptionType::UNSIGNED},
+                        {"decimal", ArgumentParser::OptionType::LONG_DOUBLE},
+                        {"flag", ArgumentParser::OptionType::BOOLEAN},
+                        {"other-flag", ArgumentParser::OptionType::BOOLEAN}
+                }));
+        parser.parse(ParseUtil::split(
+                "--signed 0x10 --unsigned +18446744073709551615 --decimal 0.1 --flag=TRUE --other-flag=False"));
+        ASSERT_EQ(parser.getOption("unsigned").getUnsigned(), UINT64_MAX);
+        // 真偽値は大文字・小文字を区別せずに変換する。(従来は`TRUE`をfalseに変換していた。)
+        ASSERT_TRUE(parser.getOption("flag").getBoolean());
+        ASSERT_FALSE(parser.getOption("other-flag").getBoolean(true));
+        // long doubleの値は、doubleを経由せずに変換される。
+        ASSERT_EQ(parser.getOption("decimal").getLongDouble(), 0.1l);
+        const std::unordered_map<std::string, std::vector<std::pair<std::string, ArgumentParser::OptionType>>>
+                correctInvalidTypeArgs({{"signed", {{"0x10", ArgumentParser::OptionType::SIGNED}}}});
+        ASSERT_EQ(parser.getInvalidOptionTypes(), correctInvalidTypeArgs);
+}
+
+TEST(ArgumentParserParse, lazyConversion) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                {
+                        {"signed", ArgumentParser::OptionType::SIGNED},
+                        {"unsigned", ArgumentParser::OptionType::UNSIGNED},
+                        {"decimal", ArgumentParser::OptionType::LONG_DOUBLE}
+                }));
+        parser.enableLazyConversion();
+        parser.parse(ParseUtil::split("--signed 0x10 --unsigned 18446744073709551616 --decimal 0.1 --signed -42"));
+        // 無効な値は、変換を遅延してもパース時に記録される。
+        const std::unordered_map<std::string, std::vector<std::pair<std::string, ArgumentParser::OptionType>>>
+                correctInvalidTypeArgs({
+                        {"signed", {{"0x10", ArgumentParser::OptionType::SIGNED}}},
+                        {"unsigned", {{"18446744073709551616", ArgumentParser::OptionType::UNSIGNED}}}
+                });
+        ASSERT_EQ(parser.getInvalidOptionTypes(), correctInvalidTypeArgs);
+        const auto decimal = parser.getResult().findOption("decimal");
+        ASSERT_NE(decimal, nullptr);
+        ASSERT_TRUE(decimal->isLongDouble());
+        ASSERT_EQ(decimal->getLongDouble(), 0.1l);
+        ASSERT_EQ(decimal->getLongDouble(), 0.1l);
+        ASSERT_EQ(parser.getOption("signed").getSigned(), -42);
+        // コピーした値は、パース結果を破棄した後も使用できる。
+        const auto value = parser.getOption("decimal");
+        parser.reset();
+        ASSERT_EQ(value.getLongDouble(), 0.1l);
+}
+
+TEST(ArgumentParserParse, stringsHeldByResult) {
+        ArgumentParser::OptionValue copied;
+        {
+                ArgumentParser parser;
+                parser.parse(ParseUtil::split("--name value-longer-than-the-small-string-buffer"));
+                const auto held = parser.findOption("name");
+                ASSERT_NE(held, nullptr);
+                copied = parser.getOption("name");
+                // 取得したOptionValueは、結果が保持する文字列とは別に文字列を所有する。
+                ASSERT_NE(copied.getStringView().data(), held->getStringView().data());
+        }
+        ASSERT_EQ(copied.getString(), "value-longer-than-the-small-string-buffer");
+}
+
+TEST(ArgumentParserParse, tryParse) {
+        ArgumentParser parser(ArgumentParser::OptionNames({{"threads", ArgumentParser::OptionType::SIGNED}}));
+        const std::vector<std::string_view> args = {"--threads", "8", "input"};
+        ASSERT_EQ(parser.tryParse(args), ArgumentParser::ErrorCode::NONE);
+        long long threads = 0;
+        ASSERT_EQ(parser.tryGetOption("threads", threads), ArgumentParser::ErrorCode::NONE);
+        ASSERT_EQ(threads, 8);
+        bool flag = false;
+        ASSERT_EQ(parser.tryGetOption("threads", flag), ArgumentParser::ErrorCode::TYPE_MISMATCH);
+        ASSERT_EQ(parser.tryGetOption("missing", threads), ArgumentParser::ErrorCode::NOT_FOUND);
+        const char* const argv[] = {"--threads", "eight"};
+        ASSERT_EQ(parser.tryParse(2, argv), ArgumentParser::ErrorCode::INVALID_ARGUMENTS);
+        ASSERT_TRUE(parser.getResult().hasErrors());
+}
+
+TEST(ArgumentParserParse, inlineValueAndBundledAlias) {
+        using type = ArgumentParser::OptionType;
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"all", type::BOOLEAN},
+                                              {"brief", type::BOOLEAN},
+                                              {"count", type::SIGNED},
+                                              {"name", type::STRING},
+                                              {"define", type::STRING_LIST}
+                                      }),
+                              ArgumentParser::OptionAlias({{"a", "all"}, {"b", "brief"}, {"c", "count"},
+                                                           {"ab", "name"}}));
+        const std::vector<std::string_view> args = {
+                "--count=-3", "--name=a=b", "--define=X", "--define", "Y", "--all=false", "-bc", "7", "-ab", "n",
+                "--=v", "x", "-ax", "input", "output"
+        };
+        parser.parseView(args);
+        // 値は引数の`=`以降を参照し、最初の`=`のみで分割する。
+        ASSERT_EQ(parser.getOption("count").getSigned(), -3);
+        ASSERT_EQ(parser.getResult().getStringList("define").size(), 2);
+        ASSERT_FALSE(parser.getOption("all").getBoolean());
+        // `-bc 7`は`-b -c 7`として扱う。
+        ASSERT_TRUE(parser.getOption("brief").getBoolean());
+        ASSERT_EQ(parser.getInvalidOptions().at("count"), std::vector<std::string>({"7"}));
+        // 1つのエイリアスとして登録されている場合は、まとめて指定したものとして扱わない。
+        ASSERT_EQ(parser.getInvalidOptions().at("name"), std::vector<std::string>({"n"}));
+        ASSERT_EQ(parser.getOption("name").getStringView(), "a=b");
+        ASSERT_EQ(parser.getOption("name").getStringView().data(), args[1].data() + 7);
+        ASSERT_EQ(parser.getInvalidOptions().at("=v"), std::vector<std::string>({"x"}));
+        ASSERT_EQ(parser.getInvalidAlias().at("ax"), std::vector<std::string>({"input"}));
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"output"}));
+}
+
+TEST(ArgumentParserClassifyToken, valid) {
+        using kind = ArgumentParser::TokenKind;
+        ASSERT_EQ(ArgumentParser::classifyToken("--value").kind, kind::OPTION);
+        ASSERT_EQ(ArgumentParser::classifyToken("--value").name_offset, 2);
+        ASSERT_EQ(ArgumentParser::classifyToken("---").kind, kind::OPTION);
+        ASSERT_EQ(ArgumentParser::classifyToken("-v").kind, kind::ALIAS);
+        ASSERT_EQ(ArgumentParser::classifyToken("-v").name_offset, 1);
+        ASSERT_EQ(ArgumentParser::classifyToken("--").kind, kind::ALIAS);
+        ASSERT_EQ(ArgumentParser::classifyToken("as--d").kind, kind::ARGUMENT);
+}
+
+TEST(ArgumentParserClassifyToken, boundary) {
+        using kind = ArgumentParser::TokenKind;
+        ASSERT_EQ(ArgumentParser::classifyToken("").kind, kind::ARGUMENT);
+        ASSERT_EQ(ArgumentParser::classifyToken("-").kind, kind::ARGUMENT);
+        // 正規表現の`.`は改行文字に一致しないため、従来の動作と同様に引数として扱われる。
+        ASSERT_EQ(ArgumentParser::classifyToken("--a\nb").kind, kind::ARGUMENT);
+        ASSERT_EQ(ArgumentParser::classifyToken("-a\r").kind, kind::ARGUMENT);
+}
+
+TEST(ArgumentParserParseView, validMap) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"value", ArgumentParser::OptionType::UNSIGNED},
+                                              {"help", ArgumentParser::OptionType::BOOLEAN},
+                                              {"name", ArgumentParser::OptionType::STRING}
+                                      }), ArgumentParser::OptionAlias({{"n", "name"}, {"h", "help"}}));
+        const char* argv[] = {"help", "--value", "4321", "--help", "-n", "test", "this", "--value", "12"};
+        parser.parseView(std::size(argv), argv);
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 4321);
+        ASSERT_TRUE(parser.getOption("help").getBoolean());
+        // 文字列型の値と引数は、argvを参照する。
+        ASSERT_EQ(parser.getOption("name").getStringView().data(), argv[5]);
+        ASSERT_EQ(parser.getArgViews().size(), 2);
+        ASSERT_EQ(parser.getArgViews()[1].data(), argv[6]);
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"help", "this"}));
+        ASSERT_EQ(parser.getInvalidOptions(), (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"value", {"12"}}})));
+}
+
+TEST(ArgumentParserParseView, diagnosticNames) {
+        const ArgumentParser::Schema schema(
+                ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::UNSIGNED}}),
+                ArgumentParser::OptionAlias({{"v", "value"}, {"w", "value"}}));
+        const std::vector<std::string_view> views{"--unknown", "z", "-x", "y", "-v", "abc"};
+        const auto result = schema.parseView(views);
+        const auto diagnostics = result.getDiagnostics();
+        ASSERT_EQ(diagnostics.size(), 3);
+        // 引数に含まれる名称は、コピーせずに呼び出し元の文字列を参照する。
+        ASSERT_EQ(diagnostics[0].name.data(), views[0].data() + 2);
+        ASSERT_EQ(diagnostics[1].name.data(), views[2].data() + 1);
+        // エイリアスから解決した名称は、結果の文字列領域にコピーされる。
+        ASSERT_EQ(diagnostics[2].name, "value");
+        ASSERT_EQ(diagnostics[2].value.data(), views[5].data());
+}
+
+TEST(ArgumentParserParseView, mixedWithOwningParse) {
+        ArgumentParser parser;
+        const std::vector<std::string_view> views{"first", "--name", "view"};
+        parser.parseView(views);
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"first"}));
+        parser.parse(ParseUtil::split("second --other owned"));
+        // コピーしたインスタンスは、元のインスタンスが破棄された後も引数を参照できる。
+        const ArgumentParser copied = [&parser] { const ArgumentParser tmp = parser; return tmp; }();
+        ASSERT_EQ(copied.getArgs(), std::vector<std::string>({"first", "second"}));
+        ASSERT_TRUE(std::ranges::equal(copied.getArgViews(), std::vector<std::string_view>({"first", "second"})));
+        ASSERT_EQ(copied.getOption("name").getString(), "view");
+        ASSERT_EQ(copied.getOption("other").getString(), "owned");
+}
+
+TEST(ArgumentParserParseView, afterOwningParse) {
+        ArgumentParser parser;
+        parser.parse(std::vector<std::string>{"first-argument-longer-than-the-small-string-buffer"});
+        const auto& args = parser.getArgs();
+        const std::vector<std::string_view> views{"second"};
+        parser.parseView(views);
+        // parse()でコピーした引数は、後から追加した引数の影響を受けない。
+        ASSERT_TRUE(std::ranges::equal(parser.getArgViews(), std::vector<std::string_view>(
+                {"first-argument-longer-than-the-small-string-buffer", "second"})));
+        // 以前に取得したgetArgs()の参照は、以降のパースの後も有効である。
+        parser.parse(std::vector<std::string>{"third"});
+        ASSERT_EQ(&parser.getArgs(), &args);
+        ASSERT_EQ(args, std::vector<std::string>({"first-argument-longer-than-the-small-string-buffer", "second", "third"}));
+}
+
+TEST(ArgumentParserMemoryResource, monotonicArena) {
+        std::array<std::byte, 4096> buffer{};
+        std::pmr::monotonic_buffer_resource arena(buffer.data(), buffer.size(),
+                                                  std::pmr::null_memory_resource());
+        const auto in_buffer = [&buffer](const std::string_view str_) {
+                const auto p = reinterpret_cast<const std::byte*>(str_.data());
+                return p >= buffer.data() && p < buffer.data() + buffer.size();
+        };
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"value", ArgumentParser::OptionType::UNSIGNED},
+                                              {"name", ArgumentParser::OptionType::STRING}
+                                      }), &arena);
+        parser.parse(ParseUtil::split("first --value 12 --name a-long-option-value-outside-sso second"));
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 12);
+        ASSERT_EQ(parser.getOption("name").getString(), "a-long-option-value-outside-sso");
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"first", "second"}));
+        // 文字列型の値と引数は、arenaに確保した文字列を参照する。(arenaは上流に確保しないため、すべてbufferに収まる。)
+        ASSERT_TRUE(in_buffer(parser.getOption("name").getStringView()));
+        ASSERT_TRUE(in_buffer(parser.getArgViews()[0]));
+        ASSERT_TRUE(in_buffer(parser.getArgViews()[1]));
+}
+
+TEST(ArgumentParserReset, reuse) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"value", ArgumentParser::OptionType::UNSIGNED},
+                                              {"name", ArgumentParser::OptionType::STRING}
+                                      }), ArgumentParser::OptionAlias({{"n", "name"}, {"v", "value"}}));
+        parser.freeze();
+        parser.parse(ParseUtil::split("first --value abc -n a-long-option-value-outside-sso --unknown x"));
+        const ArgumentParser copied = parser;
+        parser.reset();
+        ASSERT_TRUE(parser.getArgs().empty());
+        ASSERT_FALSE(parser.isExistOption("name"));
+        ASSERT_TRUE(parser.getInvalidOptions().empty());
+        ASSERT_TRUE(parser.getInvalidOptionTypes().empty());
+        // 設定はreset()の影響を受けない。
+        parser.parse(ParseUtil::split("second -v 12 --name another-long-option-value-outside-sso"));
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"second"}));
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 12);
+        ASSERT_EQ(parser.getOption("name").getString(), "another-long-option-value-outside-sso");
+        // reset()の前にコピーしたインスタンスの結果は変更されない。
+        ASSERT_EQ(copied.getArgs(), std::vector<std::string>({"first"}));
+        ASSERT_EQ(copied.getOption("name").getString(), "a-long-option-value-outside-sso");
+        ASSERT_EQ(copied.getInvalidOptions(), (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"unknown", {"x"}}})));
+}
+
+TEST(ArgumentParserSchema, parseResult) {
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                                              {
+                                                      {"value", ArgumentParser::OptionType::UNSIGNED},
+                                                      {"help", ArgumentParser::OptionType::BOOLEAN}
+                                              }), ArgumentParser::OptionAlias({{"h", "help"}, {"v", "value"}}));
+        schema.freeze();
+        const auto result = schema.parse(ParseUtil::split("first -v 12 -h --value abc -x y"));
+        ASSERT_EQ(result.getArgs(), std::vector<std::string>({"first"}));
+        ASSERT_EQ(result.getOption("value").getUnsigned(), 12);
+        ASSERT_TRUE(result.getOption("help").getBoolean());
+        ASSERT_EQ(result.getInvalidOptionTypes().at("value").size(), 1);
+        ASSERT_EQ(result.getInvalidAlias(), (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"x", {"y"}}})));
+}
+
+TEST(ArgumentParserSchema, diagnostics) {
+        using Kind = ArgumentParser::ParseResult::Diagnostic::Kind;
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::UNSIGNED}}),
+                                      ArgumentParser::OptionAlias({{"v", "value"}, {"n", "name"}}));
+        auto result = schema.parse(ParseUtil::split("first -v abc -x y --unknown z --value 1 --value 2"));
+        const auto diagnostics = result.getDiagnostics();
+        ASSERT_EQ(diagnostics.size(), 4);
+        ASSERT_EQ(diagnostics[0].kind, Kind::INVALID_OPTION_TYPE);
+        ASSERT_EQ(diagnostics[0].expected_type, ArgumentParser::OptionType::UNSIGNED);
+        ASSERT_EQ(diagnostics[0].token_index, 2);
+        ASSERT_EQ(diagnostics[0].name, "value");
+        ASSERT_EQ(diagnostics[0].value, "abc");
+        ASSERT_EQ(diagnostics[1].kind, Kind::INVALID_ALIAS);
+        ASSERT_EQ(diagnostics[1].token_index, 4);
+        ASSERT_EQ(diagnostics[2].kind, Kind::INVALID_OPTION);
+        ASSERT_EQ(diagnostics[2].name, "unknown");
+        // 重複したオプションは、値を文字列に変換して記録する。
+        ASSERT_EQ(diagnostics[3].kind, Kind::INVALID_OPTION);
+        ASSERT_EQ(diagnostics[3].token_index, 10);
+        ASSERT_EQ(diagnostics[3].value, "2");
+        ASSERT_EQ(result.getInvalidOptions(), (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"unknown", {"z"}}, {"value", {"2"}}})));
+        result.reset();
+        ASSERT_FALSE(result.hasErrors());
+        ASSERT_TRUE(result.getInvalidOptions().empty());
+}
+
+TEST(ArgumentParserSchema, diagnosticsHeldAcrossParses) {
+        ArgumentParser parser(ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::UNSIGNED}}));
+        parser.parse(ParseUtil::split("--x 1 --value abc"));
+        // 以前に取得した表の参照は、以降のパースで誤りが追加された後も有効である。
+        const auto& invalid_options = parser.getInvalidOptions();
+        const auto& invalid_option_types = parser.getInvalidOptionTypes();
+        const auto& invalid_alias = parser.getInvalidAlias();
+        parser.parse(ParseUtil::split("--y 2 --value def -z 3"));
+        ASSERT_EQ(&parser.getInvalidOptions(), &invalid_options);
+        ASSERT_EQ(invalid_options, (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"x", {"1"}}, {"y", {"2"}}})));
+        ASSERT_EQ(invalid_option_types.at("value").size(), 2);
+        ASSERT_EQ(invalid_option_types.at("value")[1].first, "def");
+        ASSERT_EQ(invalid_alias, (std::unordered_map<std::string, std::vector<std::string>>({{"z", {"3"}}})));
+        parser.reset();
+        ASSERT_TRUE(invalid_options.empty());
+        parser.parse(ParseUtil::split("--w 4"));
+        ASSERT_EQ(parser.getInvalidOptions(), (std::unordered_map<std::string, std::vector<std::string>>(
+                {{"w", {"4"}}})));
+        ASSERT_EQ(&parser.getInvalidOptions(), &invalid_options);
+}
+
+TEST(ArgumentParserSchema, optionLists) {
+        using type = ArgumentParser::OptionType;
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                                              {
+                                                      {"define", type::STRING_LIST},
+                                                      {"level", type::SIGNED_LIST},
+                                                      {"verbose", type::BOOLEAN}
+                                              }), ArgumentParser::OptionAlias({{"D", "define"}, {"v", "verbose"}}));
+        const std::vector<std::string_view> args = {
+                "--define", "A=1", "-v", "-D", "B", "--level", "-3", "--level", "x", "--level", "7", "--define", "C"
+        };
+        ArgumentParser::ParseResult result;
+        schema.parseView(args, result);
+        const auto defines = result.getStringList("define");
+        ASSERT_EQ(std::vector<std::string_view>(defines.begin(), defines.end()),
+                  std::vector<std::string_view>({"A=1", "B", "C"}));
+        // parseView()では、引数の配列を参照する。
+        ASSERT_EQ(defines[0].data(), args[1].data());
+        const auto levels = result.getSignedList("level");
+        ASSERT_EQ(std::vector<long long>(levels.begin(), levels.end()), std::vector<long long>({-3, 7}));
+        ASSERT_TRUE(result.getUnsignedList("level").empty());
+        ASSERT_TRUE(result.getSignedList("missing").empty());
+        ASSERT_TRUE(result.getInvalidOptions().empty());
+        ASSERT_EQ(result.getInvalidOptionTypes().at("level"),
+                  (std::vector<std::pair<std::string, type>>({{"x", type::SIGNED_LIST}})));
+        result.reset();
+        ASSERT_TRUE(result.getStringList("define").empty());
+        const char* const argv[] = {"-D", "X"};
+        schema.parse(2, argv, result);
+        ASSERT_EQ(result.getStringList("define").size(), 1);
+        ASSERT_EQ(result.getStringList("define")[0], "X");
+}
+
+TEST(ArgumentParserSchema, optionArrays) {
+        using type = ArgumentParser::OptionType;
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                                              {
+                                                      {"ids", type::SIGNED_ARRAY},
+                                                      {"ports", type::UNSIGNED_ARRAY},
+                                                      {"weights", type::LONG_DOUBLE_ARRAY}
+                                              }));
+        ArgumentParser::ParseResult result;
+        schema.parseView(std::vector<std::string_view>{
+                                 "--ids", "3,-1,1234567890123", "--ports", "80,x,443", "--weights", "0.25,1e2"
+                         }, result);
+        const auto ids = result.getOption("ids");
+        ASSERT_TRUE(ids.isSignedArray());
+        ASSERT_FALSE(ids.isSigned());
+        ASSERT_EQ(std::vector<long long>(ids.getSignedArray().begin(), ids.getSignedArray().end()),
+                  std::vector<long long>({3, -1, 1234567890123}));
+        ASSERT_TRUE(ids.getUnsignedArray().empty());
+        ASSERT_EQ(ids.getString(), "3,-1,1234567890123");
+        ASSERT_EQ(result.getOption("weights").getString(), "0.25,100");
+        // 不正な要素を含む配列は登録せず、要素の位置を記録する。
+        ASSERT_FALSE(result.isExistOption("ports"));
+        ASSERT_EQ(result.getDiagnostics().size(), 1);
+        const auto& diagnostic = result.getDiagnostics()[0];
+        ASSERT_EQ(diagnostic.name, "ports");
+        ASSERT_EQ(diagnostic.value, "80,x,443");
+        ASSERT_EQ(diagnostic.expected_type, type::UNSIGNED_ARRAY);
+        ASSERT_EQ(diagnostic.token_index, 3);
+        ASSERT_EQ(diagnostic.element_index, 1);
+}
+
+namespace {
+        void setEnvironment(const char* name_, const char* value_) {
+#ifdef _WIN32
+                _putenv_s(name_, value_);
+#else
+                setenv(name_, value_, 1);
+#endif
+        }
+
+        void unsetEnvironment(const char* name_) {
+#ifdef _WIN32
+                _putenv_s(name_, "");
+#else
+                unsetenv(name_);
+#endif
+        }
+
+        /**
+         * @brief 設定した環境変数を、テストが失敗した場合も含めて破棄時に取り除きます。
+         */
+        class ScopedEnvironment {
+        public:
+                ScopedEnvironment() = default;
+
+                ScopedEnvironment(const ScopedEnvironment&) = delete;
+
+                ScopedEnvironment& operator=(const ScopedEnvironment&) = delete;
+
+                ~ScopedEnvironment() { for (const auto name : _names) { unsetEnvironment(name); } }
+
+                void set(const char* name_, const char* value_) {
+                        setEnvironment(name_, value_);
+                        _names.push_back(name_);
+                }
+
+        private:
+                std::vector<const char*> _names;
+        };
+
+        /**
+         * @brief 一時ファイル・ディレクトリを、テストが失敗した場合も含めて破棄時に削除します。
+         */
+        class ScopedPath {
+        public:
+                explicit ScopedPath(std::filesystem::path path_) : _path(std::move(path_)) {}
+
+                ScopedPath(const ScopedPath&) = delete;
+
+                ScopedPath& operator=(const ScopedPath&) = delete;
+
+                ~ScopedPath() {
+                        std::error_code error;
+                        std::filesystem::remove_all(_path, error);
+                }
+
+                [[nodiscard]] const std::filesystem::path& get() const noexcept { return _path; }
+
+        private:
+                std::filesystem::path _path;
+        };
+}
+
+TEST(ArgumentParserSchema, environment) {
+        using type = ArgumentParser::OptionType;
+        ScopedEnvironment environment;
+        environment.set("NET_LN3_TEST_THREADS", "8");
+        environment.set("NET_LN3_TEST_OUTPUT_DIR", "/tmp/out");
+        environment.set("NET_LN3_TEST_VERBOSE", "true");
+        environment.set("NET_LN3_TEST_LEVEL", "high");
+        environment.set("NET_LN3_TEST_UNKNOWN", "ignored");
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                {
+                        {"threads", type::UNSIGNED},
+                        {"output-dir", type::STRING},
+                        {"verbose", type::BOOLEAN},
+                        {"level", type::SIGNED},
+                        {"name", type::STRING}
+                }));
+        parser.enableEnvironment("NET_LN3_TEST_");
+        parser.parse(std::vector<std::string>{"--threads", "2", "arg"});
+        // 引数で指定されたオプションを優先する。
+        ASSERT_EQ(parser.getOption("threads").getUnsigned(), 2);
+        ASSERT_EQ(parser.getOption("output-dir").getString(), "/tmp/out");
+        ASSERT_TRUE(parser.getOption("verbose").getBoolean());
+        ASSERT_FALSE(parser.isExistOption("name"));
+        ASSERT_FALSE(parser.isExistOption("unknown"));
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"arg"}));
+        // 型に変換できない値は、引数に由来しない誤りとして記録する。
+        ASSERT_FALSE(parser.isExistOption("level"));
+        ASSERT_EQ(parser.getInvalidOptionTypes().at("level"),
+                  (std::vector<std::pair<std::string, type>>({{"high", type::SIGNED}})));
+        ASSERT_EQ(parser.getResult().getDiagnostics().back().token_index, SIZE_MAX);
+        // 値はパース時にコピーされる。
+        environment.set("NET_LN3_TEST_OUTPUT_DIR", "/tmp/changed");
+        ASSERT_EQ(parser.getOption("output-dir").getString(), "/tmp/out");
+        parser.reset();
+        parser.parse(std::vector<std::string>{});
+        ASSERT_EQ(parser.getOption("threads").getUnsigned(), 8);
+        ASSERT_EQ(parser.getOption("output-dir").getString(), "/tmp/changed");
+}
+
+TEST(ArgumentParserSchema, environmentAcrossParses) {
+        using type = ArgumentParser::OptionType;
+        ScopedEnvironment environment;
+        environment.set("NET_LN3_TEST_DRV_THREADS", "8");
+        environment.set("NET_LN3_TEST_DRV_DEFINE", "env");
+        environment.set("NET_LN3_TEST_DRV_VERBOSE", "true");
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                {
+                        {"threads", type::UNSIGNED},
+                        {"define", type::STRING_LIST},
+                        {"verbose", type::BOOLEAN}
+                }));
+        parser.enableEnvironment("NET_LN3_TEST_DRV_");
+        parser.parse(std::vector<std::string>{"a"});
+        ASSERT_EQ(parser.getOption("threads").getUnsigned(), 8);
+        // 同じ結果に続けてパースした引数は、環境変数の値を重複とせずに置き換える。
+        parser.parse(std::vector<std::string>{"--threads", "2", "--define", "x", "--define", "y"});
+        ASSERT_EQ(parser.getOption("threads").getUnsigned(), 2);
+        const auto defines = parser.getResult().getStringList("define");
+        ASSERT_EQ(std::vector<std::string_view>(defines.begin(), defines.end()),
+                  std::vector<std::string_view>({"x", "y"}));
+        ASSERT_TRUE(parser.getOption("verbose").getBoolean());
+        ASSERT_FALSE(parser.getResult().hasErrors());
+        // 引数で置き換えた後の重複は、従来通り誤りとして記録する。
+        parser.parse(std::vector<std::string>{"--threads", "3"});
+        ASSERT_EQ(parser.getOption("threads").getUnsigned(), 2);
+        ASSERT_EQ(parser.getInvalidOptions().at("threads"), std::vector<std::string>({"3"}));
+}
+
+TEST(ArgumentParserSchema, sharedBetweenThreads) {
+        const auto schema = std::make_shared<const ArgumentParser::Schema>(ArgumentParser::OptionNames(
+                {
+                        {"value", ArgumentParser::OptionType::SIGNED},
+                        {"name", ArgumentParser::OptionType::STRING}
+                }));
+        std::vector<std::thread> threads;
+        std::array<bool, 4> succeeded{};
+        for (size_t t = 0; t < succeeded.size(); t++) {
+                threads.emplace_back([&schema, &succeeded, t] {
+                        // スレッドごとに結果を再利用し、設定は共有する。
+                        ArgumentParser parser(schema);
+                        bool ok = true;
+                        for (int i = 0; i < 1000; i++) {
+                                parser.reset();
+                                const auto value = std::to_string(i * static_cast<int>(t + 1));
+                                parser.parse(std::vector<std::string>{"--value", value, "--name", "thread", "arg"});
+                                ok = ok && parser.getOption("value").getSigned() == std::stoll(value)
+                                     && parser.getOption("name").getString() == "thread"
+                                     && parser.getArgs() == std::vector<std::string>({"arg"});
+                        }
+                        succeeded[t] = ok;
+                });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        ASSERT_TRUE(std::ranges::all_of(succeeded, [](const bool ok_) { return ok_; }));
+}
+
+TEST(ArgumentParserSchema, readFromThreads) {
+        const ArgumentParser::Schema schema(ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::SIGNED}}));
+        const auto result = schema.parse(ParseUtil::split("first --value 12 second"));
+        // const関数は結果を変更しないため、1つの結果を複数のスレッドから同時に読み取れる。
+        std::array<bool, 2> succeeded{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < succeeded.size(); t++) {
+                threads.emplace_back([&result, &succeeded, t] {
+                        bool ok = true;
+                        for (int i = 0; i < 1000; i++) {
+                                ok = ok && result.getArgs() == std::vector<std::string>({"first", "second"});
+                        }
+                        succeeded[t] = ok;
+                });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        ASSERT_TRUE(succeeded[0]);
+        ASSERT_TRUE(succeeded[1]);
+}
+
+TEST(ArgumentParserSchema, readDiagnosticsFromThreads) {
+        const ArgumentParser::Schema schema(ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::SIGNED}}));
+        const auto result = schema.parse(ParseUtil::split("--x 1 --value abc -y 2 --x 3"));
+        // 名称ごとにまとめた表は、複数のスレッドから同時に最初の取得を行っても競合しない。
+        std::array<bool, 2> succeeded{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < succeeded.size(); t++) {
+                threads.emplace_back([&result, &succeeded, t] {
+                        bool ok = true;
+                        for (int i = 0; i < 1000; i++) {
+                                ok = ok && result.getInvalidOptions().at("x") == std::vector<std::string>({"1", "3"})
+                                     && result.getInvalidOptionTypes().at("value").size() == 1
+                                     && result.getInvalidAlias().at("y") == std::vector<std::string>({"2"});
+                        }
+                        succeeded[t] = ok;
+                });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        ASSERT_TRUE(succeeded[0]);
+        ASSERT_TRUE(succeeded[1]);
+}
+
+TEST(ArgumentParserSchema, readLazyValuesFromThreads) {
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                {
+                        {"signed", ArgumentParser::OptionType::SIGNED},
+                        {"decimal", ArgumentParser::OptionType::LONG_DOUBLE}
+                }));
+        schema.enableLazyConversion();
+        const auto result = schema.parse(ParseUtil::split("--signed -42 --decimal 0.1"));
+        // 変換が遅延された値も、取得やコピーの際に結果を変更しない。
+        std::array<bool, 2> succeeded{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < succeeded.size(); t++) {
+                threads.emplace_back([&result, &succeeded, t] {
+                        bool ok = true;
+                        for (int i = 0; i < 1000; i++) {
+                                ok = ok && result.getOption("signed").getSigned() == -42
+                                     && result.findOption("decimal")->getLongDouble() == 0.1l
+                                     && result.getOption("decimal").getLongDouble() == 0.1l;
+                        }
+                        succeeded[t] = ok;
+                });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        ASSERT_TRUE(succeeded[0]);
+        ASSERT_TRUE(succeeded[1]);
+}
+
+TEST(ArgumentParserSchema, parseBatch) {
+        const ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                {
+                        {"value", ArgumentParser::OptionType::SIGNED},
+                        {"name", ArgumentParser::OptionType::STRING}
+                }));
+        std::vector<std::vector<std::string>> batch;
+        for (int i = 0; i < 1000; i++) {
+                batch.push_back({"arg" + std::to_string(i), "--value", std::to_string(i), "--name", "n" + std::to_string(i)});
+        }
+        batch.push_back({"--value", "invalid"});
+        const auto results = schema.parseBatch(batch, 4);
+        ASSERT_EQ(results.size(), batch.size());
+        for (int i = 0; i < 1000; i++) {
+                ASSERT_EQ(results[i].getArgs(), std::vector<std::string>({"arg" + std::to_string(i)}));
+                ASSERT_EQ(results[i].getOption("value").getSigned(), i);
+                ASSERT_EQ(results[i].getOption("name").getString(), "n" + std::to_string(i));
+        }
+        ASSERT_EQ(results.back().getInvalidOptionTypes().at("value").size(), 1);
+        ASSERT_TRUE(schema.parseBatch({}).empty());
+}
+
+TEST(ArgumentParserSchema, parseBatchResultsParsedOnThreads) {
+        const ArgumentParser::Schema schema(ArgumentParser::OptionNames({{"name", ArgumentParser::OptionType::STRING}}));
+        // 1つのスレッドでパースするため、すべての結果が文字列領域を共有する。
+        auto results = schema.parseBatch(std::vector<std::vector<std::string>>{{"first"}, {"second"}}, 1);
+        std::array<bool, 2> succeeded{};
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < results.size(); t++) {
+                threads.emplace_back([&schema, &results, &succeeded, t] {
+                        // それぞれの結果は、共有している領域ではなく自身の領域にコピーする。
+                        std::vector<std::string> expected = results[t].getArgs();
+                        for (int i = 0; i < 1000; i++) {
+                                const auto arg = "arg-" + std::to_string(t) + "-" + std::to_string(i);
+                                schema.parse(std::vector<std::string>{arg}, results[t]);
+                                expected.push_back(arg);
+                        }
+                        succeeded[t] = results[t].getArgs() == expected;
+                });
+        }
+        for (auto& thread : threads) { thread.join(); }
+        ASSERT_TRUE(succeeded[0]);
+        ASSERT_TRUE(succeeded[1]);
+        ASSERT_EQ(results[0].getArg(0), "first");
+        ASSERT_EQ(results[1].getArg(0), "second");
+}
+
+TEST(ArgumentParserCommandLine, parse) {
+        ArgumentParser::OptionNames names(
+                {
+                        {"value", ArgumentParser::OptionType::UNSIGNED},
+                        {"name", ArgumentParser::OptionType::STRING}
+                });
+        const std::string command = R"(build --name "quoted \"name\"" 'first arg' --value 12 plain)";
+        ArgumentParser parser(names);
+        parser.parseCommandLine(command);
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"build", "first arg", "plain"}));
+        ASSERT_EQ(parser.getOption("name").getString(), "quoted \"name\"");
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 12);
+        ArgumentParser view_parser(names);
+        view_parser.parseCommandLineView(command);
+        ASSERT_EQ(view_parser.getArgs(), parser.getArgs());
+        // 引用符を含まない引数は、commandを参照する。
+        ASSERT_EQ(view_parser.getArgViews()[0].data(), command.data());
+        ASSERT_EQ(view_parser.getArgViews()[2].data(), command.data() + command.find("plain"));
+}
+
+TEST(ArgumentParserFeed, sameAsParse) {
+        const ArgumentParser::OptionNames names(
+                {
+                        {"value", ArgumentParser::OptionType::UNSIGNED},
+                        {"help", ArgumentParser::OptionType::BOOLEAN},
+                        {"name", ArgumentParser::OptionType::STRING}
+                });
+        const ArgumentParser::OptionAlias alias({{"n", "name"}, {"h", "help"}});
+        const auto args = ParseUtil::split(
+                "first --value 12 -n a-long-option-value-outside-sso -h --value 1 --value abc -x y --unknown z --name");
+        ArgumentParser expected(names, alias);
+        expected.parse(args);
+        ArgumentParser parser(names, alias);
+        std::string buffer;
+        for (const auto& arg : args) {
+                // 呼び出し後に引数の文字列を変更しても、結果に影響しない。
+                buffer = arg;
+                parser.feed(buffer);
+                buffer.assign(buffer.size(), '#');
+        }
+        parser.finish();
+        ASSERT_EQ(parser.getArgs(), expected.getArgs());
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 12);
+        ASSERT_EQ(parser.getOption("name").getString(), "a-long-option-value-outside-sso");
+        ASSERT_TRUE(parser.getOption("help").getBoolean());
+        ASSERT_EQ(parser.getInvalidOptions(), expected.getInvalidOptions());
+        ASSERT_EQ(parser.getInvalidOptionTypes(), expected.getInvalidOptionTypes());
+        ASSERT_EQ(parser.getInvalidAlias(), expected.getInvalidAlias());
+        // finish()の後は、値を待っていたオプションの続きとして扱わない。
+        parser.feed("after");
+        ASSERT_EQ(parser.getArgs().back(), "after");
+}
+
+TEST(ArgumentParserResponseFile, expand) {
+        const ScopedPath scoped_directory(std::filesystem::temp_directory_path() / "cpp-libs-unit_test-response_file");
+        const auto& directory = scoped_directory.get();
+        std::filesystem::create_directories(directory / "nested");
+        const auto write = [](const std::filesystem::path& path_, const std::string& content_) {
+                std::ofstream(path_, std::ios::binary) << content_;
+        };
+        write(directory / "outer.rsp", "first --name 'quoted value'\n@nested/inner.rsp last");
+        // 入れ子のレスポンスファイルの相対パスは、そのファイルがあるディレクトリを基準とする。
+        write(directory / "nested" / "inner.rsp", "--value 12 inner @self.rsp");
+        write(directory / "nested" / "self.rsp", "@self.rsp");
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"value", ArgumentParser::OptionType::UNSIGNED},
+                                              {"name", ArgumentParser::OptionType::STRING}
+                                      }));
+        parser.enableResponseFiles(4);
+        parser.parse(std::vector<std::string>{"@" + (directory / "outer.rsp").string(), "@missing.rsp"});
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 12);
+        ASSERT_EQ(parser.getOption("name").getString(), "quoted value");
+        // 深さの上限を超えた場合と、ファイルを開けない場合は通常の引数として扱う。
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"first", "inner", "@self.rsp", "last", "@missing.rsp"}));
+        // 無効な場合は展開しない。
+        ArgumentParser disabled;
+        disabled.parse(std::vector<std::string>{"@" + (directory / "outer.rsp").string()});
+        ASSERT_EQ(disabled.getArgs().size(), 1);
+}
+
+TEST(ArgumentParserConfigFile, merge) {
+        using type = ArgumentParser::OptionType;
+        const ScopedPath scoped_path(std::filesystem::temp_directory_path() / "cpp-libs-unit_test-config_file.conf");
+        const auto& path = scoped_path.get();
+        std::ofstream(path, std::ios::binary)
+                << "# comment\r\n"
+                   "threads = 4\r\n"
+                   "\n"
+                   "name=from file\n"
+                   "  define=A\n"
+                   "define=B\n"
+                   "ratio=abc\n"
+                   "unknown=1\n"
+                   "no separator\n"
+                   "name=again";
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                {
+                        {"threads", type::UNSIGNED},
+                        {"name", type::STRING},
+                        {"define", type::STRING_LIST},
+                        {"ratio", type::LONG_DOUBLE},
+                        {"verbose", type::BOOLEAN}
+                }));
+        schema.enableConfigFile(path);
+        ArgumentParser::ParseResult result;
+        schema.parseView(std::vector<std::string_view>{"--threads", "16"}, result);
+        // 引数で指定されたオプションを優先する。
+        ASSERT_EQ(result.getOption("threads").getUnsigned(), 16);
+        ASSERT_EQ(result.getOption("name").getStringView(), "from file");
+        const auto defines = result.getStringList("define");
+        ASSERT_EQ(std::vector<std::string_view>(defines.begin(), defines.end()),
+                  std::vector<std::string_view>({"A", "B"}));
+        ASSERT_FALSE(result.isExistOption("verbose"));
+        ASSERT_EQ(result.getInvalidOptionTypes().at("ratio"),
+                  (std::vector<std::pair<std::string, type>>({{"abc", type::LONG_DOUBLE}})));
+        ASSERT_EQ(result.getInvalidOptions().at("unknown"), std::vector<std::string>({"1"}));
+        ASSERT_TRUE(result.getInvalidOptions().contains("no separator"));
+        ASSERT_EQ(result.getInvalidOptions().at("name"), std::vector<std::string>({"again"}));
+        ASSERT_TRUE(std::ranges::all_of(result.getDiagnostics(), [](const auto& diagnostic_) {
+                return diagnostic_.token_index == SIZE_MAX;
+        }));
+        // 引数で指定された複数の値を持つオプションは、ファイルの値を追加しない。
+        result.reset();
+        schema.parseView(std::vector<std::string_view>{"--define", "C"}, result);
+        ASSERT_EQ(result.getStringList("define").size(), 1);
+        ASSERT_EQ(result.getOption("threads").getUnsigned(), 4);
+        // 同じ結果に続けてパースした引数は、ファイルの値を置き換える。
+        schema.parseView(std::vector<std::string_view>{"--threads", "6"}, result);
+        ASSERT_EQ(result.getOption("threads").getUnsigned(), 6);
+        ASSERT_FALSE(result.getInvalidOptions().contains("threads"));
+}
+
+TEST(ArgumentParserConfigFile, mappedOnce) {
+        const ScopedPath scoped_path(std::filesystem::temp_directory_path() / "cpp-libs-unit_test-config_once.conf");
+        const auto& path = scoped_path.get();
+        std::ofstream(path, std::ios::binary) << "name=from file\nbogus=1\n";
+        ArgumentParser::Schema schema(ArgumentParser::OptionNames(
+                {
+                        {"name", ArgumentParser::OptionType::STRING},
+                        {"threads", ArgumentParser::OptionType::UNSIGNED}
+                }));
+        schema.enableConfigFile(path);
+        // 同じ結果に続けてパースしても、ファイルの誤りは一度だけ記録される。
+        ArgumentParser::ParseResult result;
+        schema.parseView(std::vector<std::string_view>{"a"}, result);
+        schema.parseView(std::vector<std::string_view>{"b"}, result);
+        ASSERT_EQ(result.getInvalidOptions().at("bogus").size(), 1);
+        ASSERT_EQ(result.getDiagnostics().size(), 1);
+        // ファイルは一度だけマップされ、すべての結果が同じ内容を参照する。
+        const auto results = schema.parseBatch(std::vector<std::vector<std::string>>{{"--threads", "1"}, {"x"}}, 2);
+        ASSERT_EQ(results.size(), 2);
+        const auto first = results[0].findOption("name");
+        const auto second = results[1].findOption("name");
+        ASSERT_NE(first, nullptr);
+        ASSERT_NE(second, nullptr);
+        ASSERT_EQ(first->getStringView().data(), second->getStringView().data());
+        ASSERT_EQ(first->getStringView().data(), result.findOption("name")->getStringView().data());
+        // キーもマップした内容を参照する。取得した値は文字列を所有する。
+        ASSERT_EQ(result.getDiagnostics()[0].name.data() - first->getStringView().data(),
+                  std::string_view("from file\n").size());
+        const auto copied = result.getOption("name");
+        ASSERT_NE(copied.getStringView().data(), first->getStringView().data());
+        ASSERT_EQ(copied.getString(), "from file");
+}
+
+TEST(ArgumentParserCommandTree, route) {
+        using type = ArgumentParser::OptionType;
+        const auto global = std::make_shared<const ArgumentParser::Schema>(
+                ArgumentParser::OptionNames({{"verbose", type::BOOLEAN}, {"config", type::STRING}}),
+                ArgumentParser::OptionAlias({{"v", "verbose"}, {"c", "config"}}));
+        const std::vector<ArgumentParser::CommandTree::Command> commands = {
+                {"build", std::make_shared<const ArgumentParser::Schema>(
+                        ArgumentParser::OptionNames({{"jobs", type::UNSIGNED}}),
+                        ArgumentParser::OptionAlias({{"j", "jobs"}, {"f", "fetch"}}))},
+                {"remote  add", std::make_shared<const ArgumentParser::Schema>(
+                        ArgumentParser::OptionNames({{"fetch", type::BOOLEAN}}))},
+                {"remote remove", nullptr},
+                {"build", nullptr}
+        };
+        const ArgumentParser::CommandTree tree(global, commands);
+        ArgumentParser::ParseResult result;
+        tree.parseView(std::vector<std::string_view>{"--config", "build", "build", "-j", "4", "-v", "target"}, result);
+        // オプションの値はサブコマンドとして扱わず、サブコマンドより前のオプションはグローバルな設定でパースする。
+        ASSERT_EQ(result.getCommand(), "build");
+        ASSERT_EQ(result.getOption("config").getStringView(), "build");
+        ASSERT_EQ(result.getOption("jobs").getUnsigned(), 4);
+        ASSERT_TRUE(result.getOption("verbose").getBoolean());
+        ASSERT_EQ(result.getArgs(), std::vector<std::string>({"target"}));
+        ASSERT_FALSE(result.hasErrors());
+        // 選択されたサブコマンドの設定に無いオプションは、グローバルな設定から検索する。
+        result.reset();
+        tree.parse(std::vector<std::string>{"remote", "add", "--fetch", "--jobs", "1", "origin"}, result);
+        ASSERT_EQ(result.getCommand(), "remote add");
+        ASSERT_TRUE(result.getOption("fetch").getBoolean());
+        ASSERT_TRUE(result.getInvalidOptions().contains("jobs"));
+        ASSERT_EQ(result.getArgs(), std::vector<std::string>({"origin"}));
+        // 親のサブコマンドは暗黙に追加され、一致しない引数で選択が確定する。
+        result.reset();
+        tree.parseView(std::vector<std::string_view>{"remote", "rename", "add"}, result);
+        ASSERT_EQ(result.getCommand(), "remote");
+        ASSERT_EQ(result.getArgs(), std::vector<std::string>({"rename", "add"}));
+        result.reset();
+        tree.parseView(std::vector<std::string_view>{"bui", "build"}, result);
+        ASSERT_EQ(result.getCommand(), "");
+        ASSERT_EQ(result.getArgs(), std::vector<std::string>({"bui", "build"}));
+        ASSERT_EQ(tree.findSchema(""), global.get());
+        ASSERT_EQ(tree.findSchema("remote remove"), global.get());
+        ASSERT_NE(tree.findSchema("remote add"), global.get());
+        ASSERT_EQ(tree.findSchema("remote list"), nullptr);
+}
+
+TEST(ArgumentParserFreeze, validMapAlias) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"value", ArgumentParser::OptionType::UNSIGNED},
+                                              {"invalid", ArgumentParser::OptionType::UNSIGNED},
+                                              {"help", ArgumentParser::OptionType::BOOLEAN},
+                                              {"name", ArgumentParser::OptionType::STRING},
+                                              {"type", ArgumentParser::OptionType::SIGNED},
+                                              {"decimal", ArgumentParser::OptionType::LONG_DOUBLE}
+                                      }),
+                              ArgumentParser::OptionAlias({{"?", "help"}, {"t", "type"}, {"p", "post"}}));
+        parser.freeze();
+        const std::string command_line =
+                "help this --value 4321 -? --name test --invalid 0.03 -t -500 decimal --decimal 0.25 --name faster --post poster list -n faster -p alias";
+        parser.parse(ParseUtil::split(command_line));
+        ASSERT_EQ(parser.getOption("value").getUnsigned(), 4321);
+        ASSERT_TRUE(parser.getOption("help").getBoolean());
+        ASSERT_EQ(parser.getOption("name").getString(), "test");
+        ASSERT_EQ(parser.getOption("type").getSigned(), -500);
+        ASSERT_EQ(parser.getOption("decimal").getLongDouble(), 0.25);
+        ASSERT_EQ(parser.getArgs(), std::vector<std::string>({"help", "this", "decimal", "list"}));
+        // 登録されていないオプションに紐づけられたエイリアスは、無効なオプションとして扱われる。
+        const std::unordered_map<std::string, std::vector<std::string>> correctInvalidArgs(
+                {
+                        {"name", {"faster"}},
+                        {"post", {"poster", "alias"}}
+                }
+        );
+        ASSERT_EQ(parser.getInvalidOptions(), correctInvalidArgs);
+        const std::unordered_map<std::string, std::vector<std::pair<std::string, ArgumentParser::OptionType>>>
+                correctInvalidTypeArgs({{"invalid", {{"0.03", ArgumentParser::OptionType::UNSIGNED}}}});
+        ASSERT_EQ(parser.getInvalidOptionTypes(), correctInvalidTypeArgs);
+        const std::unordered_map<std::string, std::vector<std::string>> correctInvalidAliasArgs({{"n", {"faster"}}});
+        ASSERT_EQ(parser.getInvalidAlias(), correctInvalidAliasArgs);
+}
+
+TEST(ArgumentParserFreeze, frozenOptionTable) {
+        ArgumentParser::OptionNames names;
+        for (int i = 0; i < 1000; i++) {
+                names.addOption("option" + std::to_string(i), ArgumentParser::OptionType::SIGNED);
+        }
+        const ArgumentParser::FrozenOptionTable table(names, ArgumentParser::OptionAlias({{"a", "option1"},
+                                                                                            {"b", "none"}}));
+        ASSERT_EQ(table.size(), 1000);
+        for (int i = 0; i < 1000; i++) {
+                const auto entry = table.findOption("option" + std::to_string(i));
+                ASSERT_TRUE(entry.has_value());
+                ASSERT_EQ(entry->name, "option" + std::to_string(i));
+        }
+        ASSERT_FALSE(table.findOption("option1000").has_value());
+        ASSERT_FALSE(table.findOption("a").has_value());
+        ASSERT_EQ(table.findAlias("a")->name, "option1");
+        ASSERT_TRUE(table.findAlias("a")->registered);
+        ASSERT_FALSE(table.findAlias("b")->registered);
+        ASSERT_FALSE(table.findAlias("option1").has_value());
+}
+
+TEST(ArgumentParserFreeze, prefixIndex) {
+        ArgumentParser::OptionNames names;
+        for (int i = 0; i < 1000; i++) {
+                names.addOption("option" + std::to_string(i), ArgumentParser::OptionType::SIGNED);
+        }
+        names.addOption("verbose", ArgumentParser::OptionType::BOOLEAN);
+        const ArgumentParser::FrozenOptionTable table(names, ArgumentParser::OptionAlias({{"ab", "option1"},
+                                                                                            {"ac", "option2"},
+                                                                                            {"x", "none"}}));
+        bool ambiguous = false;
+        ASSERT_EQ(table.resolveOptionPrefix("verb", ambiguous)->name, "verbose");
+        ASSERT_FALSE(ambiguous);
+        ASSERT_EQ(table.resolveOptionPrefix("option999", ambiguous)->name, "option999");
+        // 完全に一致するオプションを優先する。
+        ASSERT_EQ(table.resolveOptionPrefix("option1", ambiguous)->name, "option1");
+        ASSERT_FALSE(ambiguous);
+        ASSERT_FALSE(table.resolveOptionPrefix("option", ambiguous).has_value());
+        ASSERT_TRUE(ambiguous);
+        ASSERT_FALSE(table.resolveOptionPrefix("verbosity", ambiguous).has_value());
+        ASSERT_FALSE(ambiguous);
+        ASSERT_EQ(table.resolveAliasPrefix("x", ambiguous)->name, "none");
+        ASSERT_FALSE(table.resolveAliasPrefix("a", ambiguous).has_value());
+        ASSERT_TRUE(ambiguous);
+        std::vector<std::string_view> completions;
+        ASSERT_EQ(table.completeOption("option99", completions), 11);
+        ASSERT_EQ(completions.front(), "option99");
+        ASSERT_EQ(completions.back(), "option999");
+        ASSERT_TRUE(std::ranges::is_sorted(completions));
+        completions.clear();
+        ASSERT_EQ(table.completeOption("", completions), 1001);
+        ASSERT_EQ(table.completeOption("z", completions), 0);
+        completions.clear();
+        ASSERT_EQ(table.completeAlias("a", completions), 2);
+        ASSERT_EQ(completions, std::vector<std::string_view>({"ab", "ac"}));
+}
+
+TEST(ArgumentParserFreeze, abbreviation) {
+        ArgumentParser parser(ArgumentParser::OptionNames(
+                                      {
+                                              {"verbose", ArgumentParser::OptionType::BOOLEAN},
+                                              {"value", ArgumentParser::OptionType::SIGNED},
+                                              {"name", ArgumentParser::OptionType::STRING}
+                                      }),
+                              ArgumentParser::OptionAlias({{"v", "verbose"}, {"n", "name"}}));
+        parser.enableAbbreviation();
+        parser.parse(ParseUtil::split("--verb --val 10 --na abc --v 1 -nam x"));
+        ASSERT_TRUE(parser.getOption("verbose").getBoolean());
+        ASSERT_EQ(parser.getOption("value").getSigned(), 10);
+        ASSERT_EQ(parser.getOption("name").getString(), "abc");
+        ASSERT_EQ(parser.getInvalidOptions().at("v"), std::vector<std::string>({"1"}));
+        ASSERT_TRUE(parser.getInvalidAlias().contains("nam"));
+        std::vector<std::string_view> completions;
+        ASSERT_EQ(parser.getSchema()->complete("--v", completions), 2);
+        ASSERT_EQ(completions, std::vector<std::string_view>({"value", "verbose"}));
+        completions.clear();
+        ASSERT_EQ(parser.getSchema()->complete("-", completions), 2);
+        ASSERT_EQ(parser.getSchema()->complete("n", completions), 0);
+}
+
+TEST(ArgumentParserFindOption, valid) {
+        ArgumentParser parser(ArgumentParser::OptionNames({{"value", ArgumentParser::OptionType::SIGNED}}),
+                              ArgumentParser::OptionAlias({{"v", "value"}, {"n", "name"}}));
+        parser.parse(ParseUtil::split("-v 10"));
+        constexpr std::string_view name = "value";
+        ASSERT_TRUE(parser.isExistOption(name));
+        ASSERT_EQ(parser.findOption(name), parser.findOption("value"));
+        ASSERT_EQ(parser.findOption(name)->getSigned(), 10);
+        ASSERT_EQ(parser.findOption("name"), nullptr);
+        ASSERT_EQ(parser.getOption(std::string_view("name"), ArgumentParser::OptionValue::createInstance(1)).getSigned(),
+                  1);
+}
+
+TEST(ArgumentParserFindOption, optionNamesAndAlias) {
+        const ArgumentParser::OptionNames names({{"value", ArgumentParser::OptionType::SIGNED},
+                                                 {"nullity", ArgumentParser::OptionType::NULLITY}});
+        ASSERT_EQ(*names.findOptionType(std::string_view("value")), ArgumentParser::OptionType::SIGNED);
+        ASSERT_EQ(*names.findOptionType("nullity"), ArgumentParser::OptionType::NULLITY);
+        ASSERT_EQ(names.getOptionType("nullity"), ArgumentParser::OptionType::STRING);
+        ASSERT_EQ(names.findOptionType("name"), nullptr);
+        const ArgumentParser::OptionAlias alias({{"v", "value"}, {"n", "name"}});
+        ASSERT_EQ(*alias.findOptionName(std::string_view("v")), "value");
+        ASSERT_EQ(alias.findOptionName("x"), nullptr);
+        ASSERT_EQ(alias.getOptionName("x"), "");
+}
@@ -21,7 +21,9 @@
 // SOFTWARE.
 
 #include <gtest/gtest.h>
+#include <cmath>
 #include <net_ln3/cpp_lib/ArgumentParser.h>
+#include <net_ln3/cpp_lib/ParseUtil.h>
 #include <net_ln3/cpp_lib/shorthand.h>
 
 using namespace net_ln3::cpp_lib;
@@ -66,3 +68,80 @@ TEST(OptionValueGet, validCase) {
     ASSERT_EQ(ov::createInstance(std::numeric_limits<sll>().max()).getString(), "9223372036854775807");
     ASSERT_EQ(ov::createInstance(std::numeric_limits<ull>().max()).getString(), "18446744073709551615");
 }
+
+TEST(OptionValueGet, shortestRoundTrip) {
+    using ov = ArgumentParser::OptionValue;
+    ASSERT_EQ(ov::createInstance(0.1l).getString(), "0.1");
+    ASSERT_EQ(ov::createInstance(-1500.0l).getString(), "-1500");
+    ASSERT_EQ(ov::createInstance(1.5e-7l).getString(), "1.5e-7");
+    for (const long double value : {0.1l, 1.0l / 3.0l, 6.02214076e23l, -2.5e-300l,
+                                    std::numeric_limits<long double>::max(),
+                                    std::numeric_limits<long double>::min()}) {
+        const auto parsed = ParseUtil::StringValidator::parseLongDouble(ov::createInstance(value).getString());
+        ASSERT_TRUE(parsed.has_value());
+        ASSERT_EQ(*parsed, value);
+    }
+}
+
+TEST(OptionValueGet, appendString) {
+    using ov = ArgumentParser::OptionValue;
+    std::string buffer = "--count=";
+    buffer.reserve(64);
+    const auto data = buffer.data();
+    ov::createInstance(-42).appendString(buffer);
+    buffer.push_back(' ');
+    ov::createInstance(nullptr).appendString(buffer, "none");
+    buffer.push_back(' ');
+    ov::createInstance(false).appendString(buffer);
+    ASSERT_EQ(buffer, "--count=-42 none false");
+    // 容量が十分な場合は、再確保されない。
+    ASSERT_EQ(buffer.data(), data);
+}
+
+TEST(OptionValueGet, stringView) {
+    using ov = ArgumentParser::OptionValue;
+    const std::string source = "view";
+    const auto view = ov::createInstance(std::string_view(source));
+    ASSERT_TRUE(view.isString());
+    ASSERT_EQ(view.getString(), "view");
+    ASSERT_EQ(view.getStringView().data(), source.data());
+    ASSERT_EQ(ov::createInstance(1).getStringView("default"), "default");
+}
+
+TEST(OptionValueGet, tryGet) {
+    using ov = ArgumentParser::OptionValue;
+    sll s = 0;
+    ASSERT_EQ(ov::createInstance(-5).tryGet(s), ArgumentParser::ErrorCode::NONE);
+    ASSERT_EQ(s, -5);
+    ASSERT_EQ(ov::createInstance(5u).tryGet(s), ArgumentParser::ErrorCode::TYPE_MISMATCH);
+    ASSERT_EQ(ov::createInstance(nullptr).tryGet(s), ArgumentParser::ErrorCode::TYPE_MISMATCH);
+    ASSERT_EQ(s, -5);
+    const auto text = ov::createInstance("text");
+    std::string_view view;
+    ASSERT_EQ(text.tryGet(view), ArgumentParser::ErrorCode::NONE);
+    ASSERT_EQ(view, "text");
+}
+
+TEST(OptionValueGet, compactRepresentation) {
+    using ov = ArgumentParser::OptionValue;
+    static_assert(sizeof(ov) == 16);
+    auto owned = ov::createInstance(std::string(100, 'x'));
+    const auto copy = owned;
+    // 所有する文字列はコピー間で共有される。
+    ASSERT_EQ(copy.getStringView().data(), owned.getStringView().data());
+    owned = ov::createInstance(0.1l);
+    ASSERT_EQ(copy.getString(), std::string(100, 'x'));
+    ASSERT_EQ(owned.getLongDouble(), 0.1l);
+    const auto& self = owned;
+    owned = self;
+    ASSERT_EQ(owned.getLongDouble(), 0.1l);
+    // long doubleは符号・指数部を含めて、格納した値がそのまま取得できる。
+    for (const long double value : {-0.0l, std::numeric_limits<long double>::denorm_min(),
+                                    -std::numeric_limits<long double>::max(),
+                                    std::numeric_limits<long double>::infinity()}) {
+        const auto stored = ov::createInstance(value);
+        const auto copied = stored;
+        ASSERT_EQ(copied.getLongDouble(), value);
+        ASSERT_EQ(std::signbit(copied.getLongDouble()), std::signbit(value));
+    }
+}
@@ -22,6 +22,7 @@
 
 #include <net_ln3/cpp_lib/ParseUtil.h>
 #include <gtest/gtest.h>
+#include <limits>
 
 using namespace net_ln3::cpp_lib;
 
@@ -290,3 +291,142 @@ TEST(ParseUtilStringValidatorBoolean, invalid) {
     ASSERT_FALSE(ParseUtil::StringValidator::isValidBoolean("12345"));
     ASSERT_FALSE(ParseUtil::StringValidator::isValidBoolean(""));
 }
+
+// StringValidator::parse*
+
+TEST(ParseUtilStringValidatorParse, eq) {
+    ASSERT_EQ(ParseUtil::StringValidator::parseSigned("-9223372036854775808"), INT64_MIN);
+    ASSERT_EQ(ParseUtil::StringValidator::parseSigned("+42"), 42);
+    ASSERT_EQ(ParseUtil::StringValidator::parseUnsigned("18446744073709551615"), UINT64_MAX);
+    ASSERT_EQ(ParseUtil::StringValidator::parseLongDouble("-1.5e3"), -1500.0l);
+    // doubleを経由しないため、doubleで表せない値も保持される。
+    ASSERT_EQ(ParseUtil::StringValidator::parseLongDouble("0.1"), 0.1l);
+    ASSERT_EQ(ParseUtil::StringValidator::parseDouble("+0.25"), 0.25);
+    ASSERT_EQ(ParseUtil::StringValidator::parseBoolean("TRUE"), true);
+    ASSERT_EQ(ParseUtil::StringValidator::parseBoolean("False"), false);
+}
+
+TEST(ParseUtilStringValidatorParse, invalid) {
+    ASSERT_FALSE(ParseUtil::StringValidator::parseSigned("007").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseSigned("-").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseSigned("1 ").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseUnsigned("-0").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseLongDouble("1e").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseLongDouble("1E5").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseLongDouble("inf").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseLongDouble("1e10000").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseDouble("1e1000").has_value());
+    // 従来のstd::stod()と同様に、非正規化数となる値はアンダーフローとして扱う。
+    ASSERT_FALSE(ParseUtil::StringValidator::parseDouble("1e-310").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::parseDouble("-4.9e-324").has_value());
+    ASSERT_FALSE(ParseUtil::StringValidator::isValidDouble("4.9e-324"));
+    ASSERT_FALSE(ParseUtil::StringValidator::isValidLongDouble("1e-4940"));
+    ASSERT_EQ(ParseUtil::StringValidator::parseDouble("2.2250738585072014e-308"), std::numeric_limits<double>::min());
+    ASSERT_EQ(ParseUtil::StringValidator::parseDouble("0e-400"), 0.0);
+    ASSERT_FALSE(ParseUtil::StringValidator::parseBoolean("yes").has_value());
+}
+
+TEST(ParseUtilStringValidatorParse, isValidMatchesParse) {
+    // isValid*は変換を省略する場合があるが、判定はparse*と一致する。
+    for (const std::string_view str : {"999999999999999999", "9223372036854775807", "9223372036854775808",
+                                       "-9223372036854775809", "18446744073709551616"}) {
+        ASSERT_EQ(ParseUtil::StringValidator::isValidSigned(str),
+                  ParseUtil::StringValidator::parseSigned(str).has_value());
+        ASSERT_EQ(ParseUtil::StringValidator::isValidUnsigned(str),
+                  ParseUtil::StringValidator::parseUnsigned(str).has_value());
+    }
+    for (const std::string_view str : {"1.5e300", "1e308", "1e309", "1e-320", "0e999", "1.7976931348623157e308"}) {
+        ASSERT_EQ(ParseUtil::StringValidator::isValidDouble(str),
+                  ParseUtil::StringValidator::parseDouble(str).has_value());
+    }
+}
+
+TEST(ParseUtilStringValidatorParse, arrays) {
+    using sv = ParseUtil::StringValidator;
+    ASSERT_EQ(sv::countArrayElements(""), 1);
+    ASSERT_EQ(sv::countArrayElements(std::string(99, ',')), 100);
+    // 8桁ずつの変換と、残りの桁の変換が組み合わさる長さを含める。
+    const std::string_view signed_str = "0,-1,+12345678,123456789012345678,-9223372036854775808,9223372036854775807";
+    std::vector<long long> signed_values(sv::countArrayElements(signed_str));
+    ASSERT_EQ(sv::parseSignedArray(signed_str, signed_values), sv::ARRAY_VALID);
+    ASSERT_EQ(signed_values, std::vector<long long>({
+                  0, -1, 12345678, 123456789012345678, std::numeric_limits<long long>::min(),
+                  std::numeric_limits<long long>::max()
+                  }));
+    std::vector<unsigned long long> unsigned_values(3);
+    ASSERT_EQ(sv::parseUnsignedArray("7,9999999999999999999,18446744073709551615", unsigned_values), sv::ARRAY_VALID);
+    ASSERT_EQ(unsigned_values[1], 9999999999999999999ull);
+    ASSERT_EQ(unsigned_values[2], std::numeric_limits<unsigned long long>::max());
+    std::vector<long double> long_double_values(2);
+    ASSERT_EQ(sv::parseLongDoubleArray("0.5,-1e3", long_double_values), sv::ARRAY_VALID);
+    ASSERT_EQ(long_double_values, std::vector<long double>({0.5l, -1000.0l}));
+    // 最初の不正な要素の番号を返す。
+    std::vector<long long> bad(4);
+    ASSERT_EQ(sv::parseSignedArray("1,2,1234567a,4", std::span(bad).first(4)), 2);
+    ASSERT_EQ(sv::parseSignedArray("1,,3,4", bad), 1);
+    ASSERT_EQ(sv::parseSignedArray("01,2,3,4", bad), 0);
+    ASSERT_EQ(sv::parseSignedArray("1,2,3,9223372036854775808", bad), 3);
+    ASSERT_EQ(sv::parseUnsignedArray("1,-2", std::span(unsigned_values).first(2)), 1);
+    ASSERT_EQ(sv::parseLongDoubleArray("1,inf", std::span(long_double_values)), 1);
+}
+
+// ShellTokenizer
+
+namespace {
+    std::vector<std::string> tokenizeAll(const std::string_view input_) {
+        std::vector<std::string> tokens;
+        ParseUtil::ShellTokenizer tokenizer(input_);
+        while (tokenizer.next()) { tokens.emplace_back(tokenizer.getToken()); }
+        return tokens;
+    }
+}
+
+TEST(ParseUtilShellTokenizer, eq) {
+    ASSERT_EQ(tokenizeAll("  --define A=1\n\tsrc/main.cpp  "),
+              std::vector<std::string>({"--define", "A=1", "src/main.cpp"}));
+    ASSERT_EQ(tokenizeAll(R"('a b' "c \"d\" \\ \e" f\ g h\
+i '' "")"), std::vector<std::string>({"a b", R"(c "d" \ \e)", "f g", "hi", "", ""}));
+    // 閉じられていない引用符は、入力の終端で閉じられる。
+    ASSERT_EQ(tokenizeAll("a 'b c"), std::vector<std::string>({"a", "b c"}));
+    // 空白の後の行の継続は空白として扱い、空の引数を作成しない。
+    ASSERT_EQ(tokenizeAll("--foo \\\n  --bar \\\r\n\\\n baz"),
+              std::vector<std::string>({"--foo", "--bar", "baz"}));
+    ASSERT_EQ(tokenizeAll("a \\\n'' \\\n\"\""), std::vector<std::string>({"a", "", ""}));
+}
+
+TEST(ParseUtilShellTokenizer, boundary) {
+    ASSERT_TRUE(tokenizeAll("").empty());
+    ASSERT_TRUE(tokenizeAll(" \r\n\t").empty());
+    ASSERT_EQ(tokenizeAll("a\\"), std::vector<std::string>({"a\\"}));
+}
+
+TEST(ParseUtilShellTokenizer, reference) {
+    const std::string_view input = "plain 'quoted'";
+    ParseUtil::ShellTokenizer tokenizer(input);
+    // 引用符を含まない引数は、入力を参照する。
+    ASSERT_TRUE(tokenizer.next());
+    ASSERT_FALSE(tokenizer.isUnescaped());
+    ASSERT_EQ(tokenizer.getToken().data(), input.data());
+    ASSERT_TRUE(tokenizer.next());
+    ASSERT_TRUE(tokenizer.isUnescaped());
+    ASSERT_EQ(tokenizer.getToken(), "quoted");
+    ASSERT_FALSE(tokenizer.next());
+}
+
+TEST(ParseUtilShellTokenizer, longInput) {
+    // 区切り文字の検索で、複数のバイトを一度に判定する境界をまたぐ入力
+    std::string input;
+    std::vector<std::string> expected;
+    for (size_t i = 1; i < 80; i++) {
+        const std::string word(i, static_cast<char>('a' + i % 26));
+        input += word + (i % 3 == 0 ? "\t" : " ");
+        expected.push_back(word);
+        if (i % 7 == 0) {
+            input += "'" + word + " q' ";
+            expected.push_back(word + " q");
+        }
+    }
+    input += "x\\ y\x80\xff";
+    expected.emplace_back("x y\x80\xff");
+    ASSERT_EQ(tokenizeAll(input), expected);
+}